@@ -53,7 +53,14 @@ def register_action(name, action_type, schema):
     return ACTION_REGISTRY.register(name, action_type, schema)
 
 
-def register_condition(name, condition_type, schema):
+def register_condition(name, condition_type, schema, reactive=False):
+    """Register a condition.
+
+    Pass ``reactive=True`` if the condition only reads the state of the entity given by its ``id``. Conditions
+    like ``wait_until`` and ``for`` are then re-checked from the state callback of that entity instead of every loop.
+    """
+    if reactive:
+        REACTIVE_CONDITIONS.add(name)
     return CONDITION_REGISTRY.register(name, condition_type, schema)
 
 
@@ -62,6 +69,7 @@ Trigger = cg.esphome_ns.class_("Trigger")
 ACTION_REGISTRY = Registry()
 Condition = cg.esphome_ns.class_("Condition")
 CONDITION_REGISTRY = Registry()
+REACTIVE_CONDITIONS = set()
 validate_action = cv.validate_registry_entry("action", ACTION_REGISTRY)
 validate_action_list = cv.validate_registry("action", ACTION_REGISTRY)
 validate_condition = cv.validate_registry_entry("condition", CONDITION_REGISTRY)
@@ -88,6 +96,9 @@ IfAction = cg.esphome_ns.class_("IfAction", Action)
 WhileAction = cg.esphome_ns.class_("WhileAction", Action)
 RepeatAction = cg.esphome_ns.class_("RepeatAction", Action)
 WaitUntilAction = cg.esphome_ns.class_("WaitUntilAction", Action, cg.Component)
+ReactiveWaitUntilAction = cg.esphome_ns.class_(
+    "ReactiveWaitUntilAction", Action, cg.Component
+)
 UpdateComponentAction = cg.esphome_ns.class_("UpdateComponentAction", Action)
 SuspendComponentAction = cg.esphome_ns.class_("SuspendComponentAction", Action)
 ResumeComponentAction = cg.esphome_ns.class_("ResumeComponentAction", Action)
@@ -95,6 +106,9 @@ Automation = cg.esphome_ns.class_("Automation")
 
 LambdaCondition = cg.esphome_ns.class_("LambdaCondition", Condition)
 ForCondition = cg.esphome_ns.class_("ForCondition", Condition, cg.Component)
+ReactiveForCondition = cg.esphome_ns.class_(
+    "ReactiveForCondition", Condition, cg.Component
+)
 
 
 def validate_automation(extra_schema=None, extra_validators=None, single=False):
@@ -221,10 +235,18 @@ async def for_condition_to_code(config, condition_id, template_arg, args):
     condition = await build_condition(
         config[CONF_CONDITION], cg.TemplateArguments(), []
     )
+    dependencies = None
+    if not cg.is_template(config[CONF_TIME]):
+        dependencies = get_condition_dependencies(config[CONF_CONDITION])
+    if dependencies is not None:
+        condition_id = condition_id.copy()
+        condition_id.type = ReactiveForCondition
     var = cg.new_Pvariable(condition_id, template_arg, condition)
     await cg.register_component(var, config)
     templ = await cg.templatable(config[CONF_TIME], args, cg.uint32)
     cg.add(var.set_time(templ))
+    for dependency in dependencies or []:
+        cg.add(var.watch(await cg.get_variable(dependency)))
     return var
 
 
@@ -322,11 +344,17 @@ _validate_wait_until = cv.maybe_simple_value(
 @register_action("wait_until", WaitUntilAction, _validate_wait_until)
 async def wait_until_action_to_code(config, action_id, template_arg, args):
     conditions = await build_condition(config[CONF_CONDITION], template_arg, args)
+    dependencies = get_condition_dependencies(config[CONF_CONDITION])
+    if dependencies is not None:
+        action_id = action_id.copy()
+        action_id.type = ReactiveWaitUntilAction
     var = cg.new_Pvariable(action_id, template_arg, conditions)
     if CONF_TIMEOUT in config:
         template_ = await cg.templatable(config[CONF_TIMEOUT], args, cg.uint32)
         cg.add(var.set_timeout_value(template_))
     await cg.register_component(var, {})
+    for dependency in dependencies or []:
+        cg.add(var.watch(await cg.get_variable(dependency)))
     return var
 
 
@@ -413,6 +441,41 @@ async def build_condition(full_config, template_arg, args):
     return ret
 
 
+def get_condition_dependencies(full_config):
+    """Return the IDs whose state callbacks fire whenever the result of a condition may change.
+
+    Returns None if that isn't known, in which case the condition has to be polled.
+    """
+    registry_entry, config = cg.extract_registry_entry_config(
+        CONDITION_REGISTRY, full_config
+    )
+    name = registry_entry.name
+    if name in REACTIVE_CONDITIONS:
+        return [config[CONF_ID]]
+    if name == "for":
+        # A reactive for condition notifies about changes itself, including when its time has passed
+        if cg.is_template(config[CONF_TIME]):
+            return None
+        if get_condition_dependencies(config[CONF_CONDITION]) is None:
+            return None
+        return [full_config[CONF_TYPE_ID]]
+    if name == "not":
+        conditions = [config]
+    elif name in ("and", "or", "all", "any", "xor"):
+        conditions = config
+    else:
+        return None
+    dependencies = []
+    for condition in conditions:
+        condition_dependencies = get_condition_dependencies(condition)
+        if condition_dependencies is None:
+            return None
+        for dependency in condition_dependencies:
+            if dependency not in dependencies:
+                dependencies.append(dependency)
+    return dependencies
+
+
 async def build_condition_list(config, templ, args):
     conditions = []
     for conf in config:
@@ -128,11 +128,7 @@ AdalightLightEffect::Frame AdalightLightEffect::parse_frame_(light::AddressableL
   auto accepted_led_count = std::min<int>(led_count, it.size());
   uint8_t *led_data = &frame_[6];
 
-  for (int led = 0; led < accepted_led_count; led++, led_data += 3) {
-    auto white = std::min(std::min(led_data[0], led_data[1]), led_data[2]);
-
-    it[led].set(Color(led_data[0], led_data[1], led_data[2], white));
-  }
+  it.write_pixels(0, accepted_led_count, led_data, light::PIXEL_FORMAT_RGB_WHITE_MIN);
 
   it.schedule_show();
   return CONSUMED;
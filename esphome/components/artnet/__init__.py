@@ -0,0 +1,52 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components.light.effects import register_addressable_effect
+from esphome.components.pixel_protocol import (
+    CHANNELS,
+    PixelProtocolComponent,
+    PixelProtocolLightEffect,
+)
+from esphome.const import CONF_CHANNELS, CONF_ID, CONF_NAME
+
+AUTO_LOAD = ["pixel_protocol"]
+DEPENDENCIES = ["network"]
+
+artnet_ns = cg.esphome_ns.namespace("artnet")
+ArtNetComponent = artnet_ns.class_("ArtNetComponent", PixelProtocolComponent)
+
+CONF_ARTNET_ID = "artnet_id"
+CONF_UNIVERSE = "universe"
+
+ARTNET_MAX_CHANNELS = 512
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(ArtNetComponent),
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+
+@register_addressable_effect(
+    "artnet",
+    PixelProtocolLightEffect,
+    "Art-Net",
+    {
+        cv.GenerateID(CONF_ARTNET_ID): cv.use_id(ArtNetComponent),
+        cv.Optional(CONF_UNIVERSE, default=0): cv.int_range(min=0, max=32767),
+        cv.Optional(CONF_CHANNELS, default="RGB"): cv.one_of(*CHANNELS, upper=True),
+    },
+)
+async def artnet_light_effect_to_code(config, effect_id):
+    parent = await cg.get_variable(config[CONF_ARTNET_ID])
+
+    effect = cg.new_Pvariable(effect_id, config[CONF_NAME])
+    cg.add(effect.set_first_universe(config[CONF_UNIVERSE]))
+    cg.add(effect.set_universe_size(ARTNET_MAX_CHANNELS))
+    cg.add(effect.set_channels(CHANNELS[config[CONF_CHANNELS]]))
+    cg.add(effect.set_source(parent))
+    return effect
@@ -0,0 +1,51 @@
+#include "artnet.h"
+#ifdef USE_NETWORK
+#include "esphome/core/helpers.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace artnet {
+
+static const uint16_t PORT = 6454;
+
+static const uint8_t ARTNET_ID[8] = {'A', 'r', 't', '-', 'N', 'e', 't', 0};
+static const uint16_t OP_DMX = 0x5000;
+static const uint16_t OP_SYNC = 0x5200;
+
+static const size_t OPCODE_SIZE = 10;
+static const size_t DMX_HEADER_SIZE = 18;
+
+uint16_t ArtNetComponent::get_port_() const { return PORT; }
+
+pixel_protocol::PixelPacketType ArtNetComponent::parse_(const uint8_t *data, size_t len,
+                                                        pixel_protocol::PixelPacket &packet) {
+  if (len < OPCODE_SIZE || memcmp(data, ARTNET_ID, sizeof(ARTNET_ID)) != 0)
+    return pixel_protocol::PIXEL_PACKET_INVALID;
+
+  // The opcode is the only little endian field
+  uint16_t opcode = encode_uint16(data[9], data[8]);
+  if (opcode == OP_SYNC)
+    return pixel_protocol::PIXEL_PACKET_SYNC;
+  if (opcode != OP_DMX)
+    return pixel_protocol::PIXEL_PACKET_IGNORED;
+  if (len < DMX_HEADER_SIZE)
+    return pixel_protocol::PIXEL_PACKET_INVALID;
+
+  uint16_t count = encode_uint16(data[16], data[17]);
+  if (count > ARTNET_MAX_CHANNELS)
+    return pixel_protocol::PIXEL_PACKET_INVALID;
+  // Never expose bytes past the end of a truncated datagram
+  count = std::min<size_t>(count, len - DMX_HEADER_SIZE);
+
+  packet.universe = encode_uint16(data[15] & 0x7F, data[14]);
+  packet.values = data + DMX_HEADER_SIZE;
+  packet.count = count;
+  packet.sequence = data[12];
+  return pixel_protocol::PIXEL_PACKET_DATA;
+}
+
+}  // namespace artnet
+}  // namespace esphome
+#endif
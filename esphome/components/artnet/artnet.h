@@ -0,0 +1,26 @@
+#pragma once
+#include "esphome/core/defines.h"
+#ifdef USE_NETWORK
+#include "esphome/components/pixel_protocol/pixel_protocol.h"
+
+namespace esphome {
+namespace artnet {
+
+const int ARTNET_MAX_CHANNELS = 512;
+const int ARTNET_MAX_PACKET_SIZE = 18 + ARTNET_MAX_CHANNELS;
+
+/// Receiver of Art-Net ArtDmx and ArtSync packets.
+///
+/// Universes are 15-bit port addresses. ArtPoll is not answered, so controllers must be configured with the address of
+/// the node.
+class ArtNetComponent : public pixel_protocol::PixelProtocolComponent {
+ protected:
+  const char *get_protocol_name_() const override { return "Art-Net"; }
+  uint16_t get_port_() const override;
+  size_t get_max_packet_size_() const override { return ARTNET_MAX_PACKET_SIZE; }
+  pixel_protocol::PixelPacketType parse_(const uint8_t *data, size_t len, pixel_protocol::PixelPacket &packet) override;
+};
+
+}  // namespace artnet
+}  // namespace esphome
+#endif
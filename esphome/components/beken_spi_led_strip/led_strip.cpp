@@ -243,6 +243,14 @@ void BekenSPILEDStripLightOutput::set_led_params(uint8_t bit0, uint8_t bit1, uin
   this->bit0_ = bit0;
   this->bit1_ = bit1;
   this->spi_frequency_ = spi_frequency;
+
+  for (uint8_t nibble = 0; nibble < 16; nibble++) {
+    uint8_t bytes[4];
+    for (uint8_t i = 0; i < 4; i++) {
+      bytes[i] = nibble & (8 >> i) ? bit1 : bit0;
+    }
+    memcpy(&this->nibble_bytes_[nibble], bytes, 4);
+  }
 }
 
 void BekenSPILEDStripLightOutput::write_state(light::LightState *state) {
@@ -286,9 +294,9 @@ void BekenSPILEDStripLightOutput::write_state(light::LightState *state) {
 
   while (size < buffer_size) {
     uint8_t b = *psrc;
-    for (int i = 0; i < 8; i++) {
-      *pdest++ = b & (1 << (7 - i)) ? this->bit1_ : this->bit0_;
-    }
+    memcpy(pdest, &this->nibble_bytes_[b >> 4], 4);
+    memcpy(pdest + 4, &this->nibble_bytes_[b & 0x0F], 4);
+    pdest += 8;
     size++;
     psrc++;
   }
@@ -58,6 +58,7 @@ class BekenSPILEDStripLightOutput : public light::AddressableLight {
 
  protected:
   light::ESPColorView get_view_internal(int32_t index) const override;
+  bool has_flat_buffer_() const override { return true; }
 
   size_t get_buffer_size_() const { return this->num_leds_ * (this->is_rgbw_ || this->is_wrgb_ ? 4 : 3); }
 
@@ -73,6 +74,8 @@ class BekenSPILEDStripLightOutput : public light::AddressableLight {
   uint32_t spi_frequency_{6666666};
   uint8_t bit0_{0xE0};
   uint8_t bit1_{0xFC};
+  // SPI bytes of every 4-bit value, most significant bit first, as they are laid out in memory
+  uint32_t nibble_bytes_[16]{};
   RGBOrder rgb_order_;
 
   uint32_t last_refresh_{0};
@@ -568,7 +568,10 @@ BINARY_SENSOR_CONDITION_SCHEMA = maybe_simple_id(
 
 
 @automation.register_condition(
-    "binary_sensor.is_on", BinarySensorCondition, BINARY_SENSOR_CONDITION_SCHEMA
+    "binary_sensor.is_on",
+    BinarySensorCondition,
+    BINARY_SENSOR_CONDITION_SCHEMA,
+    reactive=True,
 )
 async def binary_sensor_is_on_to_code(config, condition_id, template_arg, args):
     paren = await cg.get_variable(config[CONF_ID])
@@ -576,7 +579,10 @@ async def binary_sensor_is_on_to_code(config, condition_id, template_arg, args):
 
 
 @automation.register_condition(
-    "binary_sensor.is_off", BinarySensorCondition, BINARY_SENSOR_CONDITION_SCHEMA
+    "binary_sensor.is_off",
+    BinarySensorCondition,
+    BINARY_SENSOR_CONDITION_SCHEMA,
+    reactive=True,
 )
 async def binary_sensor_is_off_to_code(config, condition_id, template_arg, args):
     paren = await cg.get_variable(config[CONF_ID])
@@ -0,0 +1,50 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components.light.effects import register_addressable_effect
+from esphome.components.pixel_protocol import (
+    CHANNELS,
+    PixelProtocolComponent,
+    PixelProtocolLightEffect,
+)
+from esphome.const import CONF_CHANNELS, CONF_ID, CONF_NAME
+
+AUTO_LOAD = ["pixel_protocol"]
+DEPENDENCIES = ["network"]
+
+ddp_ns = cg.esphome_ns.namespace("ddp")
+DDPComponent = ddp_ns.class_("DDPComponent", PixelProtocolComponent)
+
+CONF_DDP_ID = "ddp_id"
+CONF_START_PIXEL = "start_pixel"
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(DDPComponent),
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+
+@register_addressable_effect(
+    "ddp",
+    PixelProtocolLightEffect,
+    "DDP",
+    {
+        cv.GenerateID(CONF_DDP_ID): cv.use_id(DDPComponent),
+        cv.Optional(CONF_START_PIXEL, default=0): cv.positive_int,
+        cv.Optional(CONF_CHANNELS, default="RGB"): cv.one_of(*CHANNELS, upper=True),
+    },
+)
+async def ddp_light_effect_to_code(config, effect_id):
+    parent = await cg.get_variable(config[CONF_DDP_ID])
+
+    effect = cg.new_Pvariable(effect_id, config[CONF_NAME])
+    cg.add(effect.set_first_universe(ddp_ns.DDP_ID_DISPLAY))
+    cg.add(effect.set_start_pixel(config[CONF_START_PIXEL]))
+    cg.add(effect.set_channels(CHANNELS[config[CONF_CHANNELS]]))
+    cg.add(effect.set_source(parent))
+    return effect
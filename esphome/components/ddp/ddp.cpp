@@ -0,0 +1,62 @@
+#include "ddp.h"
+#ifdef USE_NETWORK
+#include "esphome/core/helpers.h"
+
+#include <algorithm>
+
+namespace esphome {
+namespace ddp {
+
+static const uint16_t PORT = 4048;
+
+static const uint8_t FLAG_VERSION_MASK = 0xC0;
+static const uint8_t FLAG_VERSION_1 = 0x40;
+static const uint8_t FLAG_TIMECODE = 0x10;
+static const uint8_t FLAG_STORAGE = 0x08;
+static const uint8_t FLAG_REPLY = 0x04;
+static const uint8_t FLAG_QUERY = 0x02;
+static const uint8_t FLAG_PUSH = 0x01;
+
+static const uint8_t ID_ALL = 255;
+
+static const size_t HEADER_SIZE = 10;
+static const size_t TIMECODE_SIZE = 4;
+
+uint16_t DDPComponent::get_port_() const { return PORT; }
+
+pixel_protocol::PixelPacketType DDPComponent::parse_(const uint8_t *data, size_t len,
+                                                     pixel_protocol::PixelPacket &packet) {
+  if (len < HEADER_SIZE)
+    return pixel_protocol::PIXEL_PACKET_INVALID;
+
+  uint8_t flags = data[0];
+  if ((flags & FLAG_VERSION_MASK) != FLAG_VERSION_1)
+    return pixel_protocol::PIXEL_PACKET_INVALID;
+  if (flags & (FLAG_STORAGE | FLAG_REPLY | FLAG_QUERY))
+    return pixel_protocol::PIXEL_PACKET_IGNORED;
+  if (data[3] != DDP_ID_DISPLAY && data[3] != ID_ALL)
+    return pixel_protocol::PIXEL_PACKET_IGNORED;
+
+  size_t header = HEADER_SIZE + (flags & FLAG_TIMECODE ? TIMECODE_SIZE : 0);
+  if (len < header)
+    return pixel_protocol::PIXEL_PACKET_INVALID;
+
+  uint32_t offset = encode_uint32(data[4], data[5], data[6], data[7]);
+  // Never expose bytes past the end of a truncated datagram
+  size_t count = std::min<size_t>(encode_uint16(data[8], data[9]), len - header);
+  if (count == 0)
+    return flags & FLAG_PUSH ? pixel_protocol::PIXEL_PACKET_SYNC : pixel_protocol::PIXEL_PACKET_IGNORED;
+
+  packet.universe = DDP_ID_DISPLAY;
+  packet.offset = offset;
+  packet.count = count;
+  packet.values = data + header;
+  // Senders disagree on whether the 4-bit sequence counts packets or frames, so it is not checked
+  packet.sequence = 0;
+  packet.push = flags & FLAG_PUSH;
+  return pixel_protocol::PIXEL_PACKET_DATA;
+}
+
+}  // namespace ddp
+}  // namespace esphome
+#endif
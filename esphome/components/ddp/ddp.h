@@ -0,0 +1,28 @@
+#pragma once
+#include "esphome/core/defines.h"
+#ifdef USE_NETWORK
+#include "esphome/components/pixel_protocol/pixel_protocol.h"
+
+namespace esphome {
+namespace ddp {
+
+/// Destination ID of the default output device.
+const uint8_t DDP_ID_DISPLAY = 1;
+/// Largest DDP datagram that fits an Ethernet frame without fragmentation.
+const int DDP_MAX_PACKET_SIZE = 1472;
+
+/// Receiver of the Distributed Display Protocol, as sent by xLights, WLED and others.
+///
+/// Pixel data of the default output is a single universe, addressed by byte offset. Packets with the push flag complete
+/// a frame. Queries are not answered, so senders must be configured with the address of the node.
+class DDPComponent : public pixel_protocol::PixelProtocolComponent {
+ protected:
+  const char *get_protocol_name_() const override { return "DDP"; }
+  uint16_t get_port_() const override;
+  size_t get_max_packet_size_() const override { return DDP_MAX_PACKET_SIZE; }
+  pixel_protocol::PixelPacketType parse_(const uint8_t *data, size_t len, pixel_protocol::PixelPacket &packet) override;
+};
+
+}  // namespace ddp
+}  // namespace esphome
+#endif
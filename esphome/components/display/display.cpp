@@ -54,47 +54,34 @@ void Display::line_at_angle(int x, int y, int angle, int start_radius, int stop_
 void Display::draw_pixels_at(int x_start, int y_start, int w, int h, const uint8_t *ptr, ColorOrder order,
                              ColorBitness bitness, bool big_endian, int x_offset, int y_offset, int x_pad) {
   size_t line_stride = x_offset + w + x_pad;  // length of each source line in pixels
-  uint32_t color_value;
   for (int y = 0; y != h; y++) {
     size_t source_idx = (y_offset + y) * line_stride + x_offset;
-    size_t source_idx_mod;
     for (int x = 0; x != w; x++, source_idx++) {
-      switch (bitness) {
-        default:
-          color_value = ptr[source_idx];
-          break;
-        case COLOR_BITNESS_565:
-          source_idx_mod = source_idx * 2;
-          if (big_endian) {
-            color_value = (ptr[source_idx_mod] << 8) + ptr[source_idx_mod + 1];
-          } else {
-            color_value = ptr[source_idx_mod] + (ptr[source_idx_mod + 1] << 8);
-          }
-          break;
-        case COLOR_BITNESS_888:
-          source_idx_mod = source_idx * 3;
-          if (big_endian) {
-            color_value = (ptr[source_idx_mod + 0] << 16) + (ptr[source_idx_mod + 1] << 8) + ptr[source_idx_mod + 2];
-          } else {
-            color_value = ptr[source_idx_mod + 0] + (ptr[source_idx_mod + 1] << 8) + (ptr[source_idx_mod + 2] << 16);
-          }
-          break;
-      }
+      uint32_t color_value = read_pixel_(ptr, source_idx, bitness, big_endian);
       this->draw_pixel_at(x + x_start, y + y_start, ColorUtil::to_color(color_value, order, bitness));
     }
   }
 }
 
-void HOT Display::horizontal_line(int x, int y, int width, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = x; i < x + width; i++)
-    this->draw_pixel_at(i, y, color);
-}
-void HOT Display::vertical_line(int x, int y, int height, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = y; i < y + height; i++)
-    this->draw_pixel_at(x, i, color);
+uint32_t HOT Display::read_pixel_(const uint8_t *ptr, size_t index, ColorBitness bitness, bool big_endian) {
+  switch (bitness) {
+    default:
+      return ptr[index];
+    case COLOR_BITNESS_565:
+      ptr += index * 2;
+      if (big_endian)
+        return (ptr[0] << 8) + ptr[1];
+      return ptr[0] + (ptr[1] << 8);
+    case COLOR_BITNESS_888:
+      ptr += index * 3;
+      if (big_endian)
+        return (ptr[0] << 16) + (ptr[1] << 8) + ptr[2];
+      return ptr[0] + (ptr[1] << 8) + (ptr[2] << 16);
+  }
 }
+
+void HOT Display::horizontal_line(int x, int y, int width, Color color) { this->fill_span(x, y, width, color); }
+void HOT Display::vertical_line(int x, int y, int height, Color color) { this->fill_rect(x, y, 1, height, color); }
 void Display::rectangle(int x1, int y1, int width, int height, Color color) {
   this->horizontal_line(x1, y1, width, color);
   this->horizontal_line(x1, y1 + height - 1, width, color);
@@ -102,9 +89,13 @@ void Display::rectangle(int x1, int y1, int width, int height, Color color) {
   this->vertical_line(x1 + width - 1, y1, height, color);
 }
 void Display::filled_rectangle(int x1, int y1, int width, int height, Color color) {
-  // Future: Use vertical_line and horizontal_line methods depending on rotation to reduce memory accesses.
-  for (int i = y1; i < y1 + height; i++) {
-    this->horizontal_line(x1, i, width, color);
+  this->fill_rect(x1, y1, width, height, color);
+}
+void HOT Display::fill_span(int x, int y, int width, Color color) { this->fill_rect(x, y, width, 1, color); }
+void HOT Display::fill_rect(int x, int y, int width, int height, Color color) {
+  for (int j = y; j < y + height; j++) {
+    for (int i = x; i < x + width; i++)
+      this->draw_pixel_at(i, j, color);
   }
 }
 void HOT Display::circle(int center_x, int center_xy, int radius, Color color) {
@@ -272,6 +272,17 @@ class Display : public PollingComponent {
   /// Draw a vertical line from the point [x,y] to [x,y+width] with the given color.
   void vertical_line(int x, int y, int height, Color color = COLOR_ON);
 
+  /// Fill a horizontal run of width pixels starting at [x,y] with the given color.
+  ///
+  /// The default implementation forwards to fill_rect(), displays with a native span write may override it.
+  virtual void fill_span(int x, int y, int width, Color color);
+
+  /// Fill a width x height rectangle with the top left point at [x,y] with the given color.
+  ///
+  /// This is what every filled primitive ends up in. The default implementation calls draw_pixel_at() for each
+  /// pixel; buffered displays override it to resolve clipping and rotation once per rectangle.
+  virtual void fill_rect(int x, int y, int width, int height, Color color);
+
   /// Draw the outline of a rectangle with the top left point at [x1,y1] and the bottom right point at
   /// [x1+width,y1+height].
   void rectangle(int x1, int y1, int width, int height, Color color = COLOR_ON);
@@ -645,6 +656,8 @@ class Display : public PollingComponent {
  protected:
   bool clamp_x_(int x, int w, int &min_x, int &max_x);
   bool clamp_y_(int y, int h, int &min_y, int &max_y);
+  /// Read the packed pixel at index from a draw_pixels_at() source buffer.
+  static uint32_t read_pixel_(const uint8_t *ptr, size_t index, ColorBitness bitness, bool big_endian);
   void vprintf_(int x, int y, BaseFont *font, Color color, Color background, TextAlign align, const char *format,
                 va_list arg);
 
@@ -1,5 +1,6 @@
 #include "display_buffer.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "esphome/core/application.h"
@@ -20,6 +21,100 @@ void DisplayBuffer::init_internal_(uint32_t buffer_length) {
   this->clear();
 }
 
+void DisplayBuffer::init_dirty_tiles_(uint8_t tile_shift) {
+  const int tile_size = 1 << tile_shift;
+  this->dirty_tile_shift_ = tile_shift;
+  this->dirty_tile_columns_ = (this->get_width_internal() + tile_size - 1) >> tile_shift;
+  this->dirty_tile_rows_ = (this->get_height_internal() + tile_size - 1) >> tile_shift;
+  const size_t tiles = (size_t) this->dirty_tile_columns_ * this->dirty_tile_rows_;
+  this->dirty_tiles_.assign((tiles + 31) / 32, 0);
+  this->mark_dirty_(0, 0, this->get_width_internal(), this->get_height_internal());
+}
+
+void HOT DisplayBuffer::mark_dirty_(int x, int y, int width, int height) {
+  if (this->dirty_tiles_.empty())
+    return;
+  const int x_end = std::min(x + width, this->get_width_internal());
+  const int y_end = std::min(y + height, this->get_height_internal());
+  x = std::max(x, 0);
+  y = std::max(y, 0);
+  if (x >= x_end || y >= y_end)
+    return;
+  const int tx_end = ((x_end - 1) >> this->dirty_tile_shift_) + 1;
+  const int ty_end = ((y_end - 1) >> this->dirty_tile_shift_) + 1;
+  for (int ty = y >> this->dirty_tile_shift_; ty != ty_end; ty++) {
+    for (int tx = x >> this->dirty_tile_shift_; tx != tx_end; tx++) {
+      const size_t tile = (size_t) ty * this->dirty_tile_columns_ + tx;
+      this->dirty_tiles_[tile / 32] |= 1u << (tile % 32);
+    }
+  }
+}
+
+bool DisplayBuffer::has_dirty_tiles_() const {
+  for (uint32_t word : this->dirty_tiles_) {
+    if (word != 0)
+      return true;
+  }
+  return false;
+}
+
+void DisplayBuffer::clear_dirty_tiles_() { std::fill(this->dirty_tiles_.begin(), this->dirty_tiles_.end(), 0); }
+
+size_t DisplayBuffer::flush_dirty_tiles_() {
+  // A run of dirty tiles in tile coordinates, x_end and y_end are exclusive.
+  struct TileRun {
+    uint16_t x, x_end, y, y_end;
+  };
+  auto is_dirty = [this](int tx, int ty) {
+    const size_t tile = (size_t) ty * this->dirty_tile_columns_ + tx;
+    return (this->dirty_tiles_[tile / 32] & (1u << (tile % 32))) != 0;
+  };
+  size_t count = 0;
+  auto write = [this, &count](const TileRun &run) {
+    const int shift = this->dirty_tile_shift_;
+    const int x = run.x << shift;
+    const int y = run.y << shift;
+    const int x_end = std::min(run.x_end << shift, this->get_width_internal());
+    const int y_end = std::min(run.y_end << shift, this->get_height_internal());
+    this->write_dirty_rect_(x, y, x_end - x, y_end - y);
+    count++;
+  };
+
+  // Horizontal runs of dirty tiles are merged with the run directly above them when they cover the same columns,
+  // so a changed block becomes one rectangle and a full frame a single write.
+  std::vector<TileRun> open, next;
+  for (uint16_t ty = 0; ty != this->dirty_tile_rows_; ty++) {
+    next.clear();
+    uint16_t tx = 0;
+    while (tx != this->dirty_tile_columns_) {
+      if (!is_dirty(tx, ty)) {
+        tx++;
+        continue;
+      }
+      const uint16_t start = tx;
+      while (tx != this->dirty_tile_columns_ && is_dirty(tx, ty))
+        tx++;
+      auto it = std::find_if(open.begin(), open.end(),
+                             [start, tx](const TileRun &run) { return run.x == start && run.x_end == tx; });
+      if (it != open.end()) {
+        it->y_end = ty + 1;
+        next.push_back(*it);
+        open.erase(it);
+      } else {
+        next.push_back(TileRun{start, tx, ty, (uint16_t) (ty + 1)});
+      }
+    }
+    for (const auto &run : open)
+      write(run);
+    std::swap(open, next);
+  }
+  for (const auto &run : open)
+    write(run);
+
+  this->clear_dirty_tiles_();
+  return count;
+}
+
 int DisplayBuffer::get_width() {
   switch (this->rotation_) {
     case DISPLAY_ROTATION_90_DEGREES:
@@ -48,6 +143,90 @@ void HOT DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
   if (!this->get_clipping().inside(x, y))
     return;  // NOLINT
 
+  this->to_absolute_(x, y);
+  this->draw_absolute_pixel_internal(x, y, color);
+  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::fill_rect(int x, int y, int width, int height, Color color) {
+  if (!this->clip_rect_(x, y, width, height))
+    return;
+
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+      break;
+    case DISPLAY_ROTATION_90_DEGREES: {
+      int native_x = this->get_width_internal() - y - height;
+      y = x;
+      x = native_x;
+      std::swap(width, height);
+      break;
+    }
+    case DISPLAY_ROTATION_180_DEGREES:
+      x = this->get_width_internal() - x - width;
+      y = this->get_height_internal() - y - height;
+      break;
+    case DISPLAY_ROTATION_270_DEGREES: {
+      int native_y = this->get_height_internal() - x - width;
+      x = y;
+      y = native_y;
+      std::swap(width, height);
+      break;
+    }
+  }
+  this->fill_absolute_rect_internal(x, y, width, height, color);
+  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::draw_pixels_at(int x_start, int y_start, int w, int h, const uint8_t *ptr, ColorOrder order,
+                                       ColorBitness bitness, bool big_endian, int x_offset, int y_offset, int x_pad) {
+  const size_t line_stride = x_offset + w + x_pad;  // length of each source line in pixels
+  int x = x_start, y = y_start;
+  if (!this->clip_rect_(x, y, w, h))
+    return;
+  x_offset += x - x_start;
+  y_offset += y - y_start;
+
+  for (int row = 0; row != h; row++) {
+    size_t source_idx = (y_offset + row) * line_stride + x_offset;
+    for (int col = 0; col != w; col++, source_idx++) {
+      int pixel_x = x + col, pixel_y = y + row;
+      this->to_absolute_(pixel_x, pixel_y);
+      Color color;
+      if (bitness == COLOR_BITNESS_888 && order == COLOR_ORDER_RGB && big_endian) {
+        // most common case for decoded images, skip the generic scaling in to_color()
+        const uint8_t *pixel = ptr + source_idx * 3;
+        color = Color(pixel[0], pixel[1], pixel[2]);
+      } else {
+        color = ColorUtil::to_color(read_pixel_(ptr, source_idx, bitness, big_endian), order, bitness);
+      }
+      this->draw_absolute_pixel_internal(pixel_x, pixel_y, color);
+    }
+  }
+  App.feed_wdt();
+}
+
+bool HOT DisplayBuffer::clip_rect_(int &x, int &y, int &width, int &height) {
+  int x_end = std::min(x + width, this->get_width());
+  int y_end = std::min(y + height, this->get_height());
+  x = std::max(x, 0);
+  y = std::max(y, 0);
+  Rect clipping = this->get_clipping();
+  if (clipping.is_set()) {
+    // Rect::inside() treats the right and bottom edge as part of the rectangle, keep the same result as draw_pixel_at()
+    x = std::max(x, (int) clipping.x);
+    y = std::max(y, (int) clipping.y);
+    x_end = std::min(x_end, clipping.x2() + 1);
+    y_end = std::min(y_end, clipping.y2() + 1);
+  }
+  if (x >= x_end || y >= y_end)
+    return false;
+  width = x_end - x;
+  height = y_end - y;
+  return true;
+}
+
+void HOT DisplayBuffer::to_absolute_(int &x, int &y) {
   switch (this->rotation_) {
     case DISPLAY_ROTATION_0_DEGREES:
       break;
@@ -64,8 +243,13 @@ void HOT DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
       y = this->get_height_internal() - y - 1;
       break;
   }
-  this->draw_absolute_pixel_internal(x, y, color);
-  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  for (int j = y; j < y + height; j++) {
+    for (int i = x; i < x + width; i++)
+      this->draw_absolute_pixel_internal(i, j, color);
+  }
 }
 
 }  // namespace display
@@ -22,12 +22,49 @@ class DisplayBuffer : public Display {
   /// Set a single pixel at the specified coordinates to the given color.
   void draw_pixel_at(int x, int y, Color color) override;
 
+  /// Fill a rectangle, clipping and rotating it once before handing it to fill_absolute_rect_internal().
+  void fill_rect(int x, int y, int width, int height, Color color) override;
+
+  using Display::draw_pixels_at;
+  /// Copy a block of pixels into the buffer, clipping it once instead of going through draw_pixel_at() per pixel.
+  void draw_pixels_at(int x_start, int y_start, int w, int h, const uint8_t *ptr, ColorOrder order,
+                      ColorBitness bitness, bool big_endian, int x_offset, int y_offset, int x_pad) override;
+
  protected:
   virtual void draw_absolute_pixel_internal(int x, int y, Color color) = 0;
 
+  /// Clip a rectangle in rotated coordinates to the display and the current clipping rectangle.
+  /// Returns false if nothing is left.
+  bool clip_rect_(int &x, int &y, int &width, int &height);
+  /// Map a point from rotated to unrotated display coordinates.
+  void to_absolute_(int &x, int &y);
+
+  /// Fill a rectangle given in unrotated display coordinates. The rectangle is already clipped to the display, drivers
+  /// with a frame buffer can override this to write whole rows instead of single pixels.
+  virtual void fill_absolute_rect_internal(int x, int y, int width, int height, Color color);
+
   void init_internal_(uint32_t buffer_length);
 
+  /// Start tracking changed parts of the buffer in square tiles of (1 << tile_shift) pixels. All tiles start out dirty
+  /// so the first flush sends the whole frame.
+  void init_dirty_tiles_(uint8_t tile_shift = 4);
+  /// Mark a rectangle in unrotated display coordinates as changed. Drivers call this when the buffer content changes.
+  void mark_dirty_(int x, int y, int width, int height);
+  /// Return true if any tile changed since the last flush.
+  bool has_dirty_tiles_() const;
+  /// Forget all changes, e.g. after the driver sent the whole buffer by other means.
+  void clear_dirty_tiles_();
+  /// Coalesce the dirty tiles into rectangles, pass each to write_dirty_rect_() and clear the tracker.
+  /// Returns the number of rectangles written.
+  size_t flush_dirty_tiles_();
+  /// Driver hook to send one changed rectangle (unrotated display coordinates) from the buffer to the display.
+  virtual void write_dirty_rect_(int x, int y, int width, int height) {}
+
   uint8_t *buffer_{nullptr};
+  std::vector<uint32_t> dirty_tiles_;
+  uint16_t dirty_tile_columns_{0};
+  uint16_t dirty_tile_rows_{0};
+  uint8_t dirty_tile_shift_{4};
 };
 
 }  // namespace display
@@ -1,26 +1,24 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome.components.light.types import AddressableLightEffect
 from esphome.components.light.effects import register_addressable_effect
+from esphome.components.pixel_protocol import (
+    CHANNELS,
+    PixelProtocolComponent,
+    PixelProtocolLightEffect,
+)
 from esphome.const import CONF_ID, CONF_NAME, CONF_METHOD, CONF_CHANNELS
 
-AUTO_LOAD = ["socket"]
+AUTO_LOAD = ["pixel_protocol"]
 DEPENDENCIES = ["network"]
 
 e131_ns = cg.esphome_ns.namespace("e131")
 E131AddressableLightEffect = e131_ns.class_(
-    "E131AddressableLightEffect", AddressableLightEffect
+    "E131AddressableLightEffect", PixelProtocolLightEffect
 )
-E131Component = e131_ns.class_("E131Component", cg.Component)
+E131Component = e131_ns.class_("E131Component", PixelProtocolComponent)
 
 METHODS = {"UNICAST": e131_ns.E131_UNICAST, "MULTICAST": e131_ns.E131_MULTICAST}
 
-CHANNELS = {
-    "MONO": e131_ns.E131_MONO,
-    "RGB": e131_ns.E131_RGB,
-    "RGBW": e131_ns.E131_RGBW,
-}
-
 CONF_UNIVERSE = "universe"
 CONF_E131_ID = "e131_id"
 
@@ -1,55 +1,33 @@
 #pragma once
 #include "esphome/core/defines.h"
 #ifdef USE_NETWORK
-#include "esphome/components/socket/socket.h"
-#include "esphome/core/component.h"
-
-#include <cinttypes>
-#include <map>
-#include <memory>
-#include <set>
-#include <vector>
+#include "esphome/components/pixel_protocol/pixel_protocol.h"
 
 namespace esphome {
 namespace e131 {
 
-class E131AddressableLightEffect;
-
 enum E131ListenMethod { E131_MULTICAST, E131_UNICAST };
 
 const int E131_MAX_PROPERTY_VALUES_COUNT = 513;
+const int E131_MAX_PACKET_SIZE = 638;
 
-struct E131Packet {
-  uint16_t count;
-  uint8_t values[E131_MAX_PROPERTY_VALUES_COUNT];
-};
-
-class E131Component : public esphome::Component {
+class E131Component : public pixel_protocol::PixelProtocolComponent {
  public:
-  E131Component();
-  ~E131Component();
-
   void setup() override;
-  void loop() override;
-  float get_setup_priority() const override { return setup_priority::AFTER_WIFI; }
-
-  void add_effect(E131AddressableLightEffect *light_effect);
-  void remove_effect(E131AddressableLightEffect *light_effect);
 
   void set_method(E131ListenMethod listen_method) { this->listen_method_ = listen_method; }
 
  protected:
-  bool packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet);
-  bool process_(int universe, const E131Packet &packet);
+  const char *get_protocol_name_() const override { return "E1.31"; }
+  uint16_t get_port_() const override;
+  size_t get_max_packet_size_() const override { return E131_MAX_PACKET_SIZE; }
+  pixel_protocol::PixelPacketType parse_(const uint8_t *data, size_t len, pixel_protocol::PixelPacket &packet) override;
+  void join_(uint16_t universe) override;
+  void leave_(uint16_t universe) override;
+
   bool join_igmp_groups_();
-  void join_(int universe);
-  void leave_(int universe);
 
   E131ListenMethod listen_method_{E131_MULTICAST};
-  std::unique_ptr<socket::Socket> socket_;
-  std::set<E131AddressableLightEffect *> light_effects_;
-  std::map<int, int> universe_consumers_;
-  std::map<int, E131Packet> universe_packets_;
 };
 
 }  // namespace e131
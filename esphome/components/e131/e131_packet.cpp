@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cstring>
 #include "e131.h"
 #ifdef USE_NETWORK
@@ -17,7 +18,9 @@ static const char *const TAG = "e131";
 
 static const uint8_t ACN_ID[12] = {0x41, 0x53, 0x43, 0x2d, 0x45, 0x31, 0x2e, 0x31, 0x37, 0x00, 0x00, 0x00};
 static const uint32_t VECTOR_ROOT = 4;
+static const uint32_t VECTOR_ROOT_EXTENDED = 8;
 static const uint32_t VECTOR_FRAME = 2;
+static const uint32_t VECTOR_FRAME_SYNCHRONIZATION = 1;
 static const uint8_t VECTOR_DMP = 2;
 
 // E1.31 Packet Structure
@@ -51,12 +54,14 @@ union E131RawPacket {
     uint8_t property_values[E131_MAX_PROPERTY_VALUES_COUNT];
   } __attribute__((packed));
 
-  uint8_t raw[638];
+  uint8_t raw[E131_MAX_PACKET_SIZE];
 };
 
 // We need to have at least one `1` value
 // Get the offset of `property_values[1]`
 const size_t E131_MIN_PACKET_SIZE = reinterpret_cast<size_t>(&((E131RawPacket *) nullptr)->property_values[1]);
+// Synchronization packets end after the frame vector, sequence number, synchronization address and reserved bytes
+const size_t E131_SYNC_PACKET_SIZE = reinterpret_cast<size_t>(&((E131RawPacket *) nullptr)->source_name[5]);
 
 bool E131Component::join_igmp_groups_() {
   if (listen_method_ != E131_MULTICAST)
@@ -64,10 +69,7 @@ bool E131Component::join_igmp_groups_() {
   if (this->socket_ == nullptr)
     return false;
 
-  for (auto universe : universe_consumers_) {
-    if (!universe.second)
-      continue;
-
+  for (auto &universe : universes_) {
     ip4_addr_t multicast_addr =
         network::IPAddress(239, 255, ((universe.first >> 8) & 0xff), ((universe.first >> 0) & 0xff));
 
@@ -81,26 +83,13 @@ bool E131Component::join_igmp_groups_() {
   return true;
 }
 
-void E131Component::join_(int universe) {
-  // store only latest received packet for the given universe
-  auto consumers = ++universe_consumers_[universe];
-
-  if (consumers > 1) {
-    return;  // we already joined before
-  }
-
+void E131Component::join_(uint16_t universe) {
   if (join_igmp_groups_()) {
     ESP_LOGD(TAG, "Joined %d universe for E1.31.", universe);
   }
 }
 
-void E131Component::leave_(int universe) {
-  auto consumers = --universe_consumers_[universe];
-
-  if (consumers > 0) {
-    return;  // we have other consumers of the given universe
-  }
-
+void E131Component::leave_(uint16_t universe) {
   if (listen_method_ == E131_MULTICAST) {
     ip4_addr_t multicast_addr = network::IPAddress(239, 255, ((universe >> 8) & 0xff), ((universe >> 0) & 0xff));
 
@@ -110,30 +99,44 @@ void E131Component::leave_(int universe) {
   ESP_LOGD(TAG, "Left %d universe for E1.31.", universe);
 }
 
-bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet) {
-  if (data.size() < E131_MIN_PACKET_SIZE)
-    return false;
+pixel_protocol::PixelPacketType E131Component::parse_(const uint8_t *data, size_t len,
+                                                      pixel_protocol::PixelPacket &packet) {
+  if (len < E131_SYNC_PACKET_SIZE)
+    return pixel_protocol::PIXEL_PACKET_INVALID;
 
-  auto *sbuff = reinterpret_cast<const E131RawPacket *>(&data[0]);
+  // Parsed in place, the returned values point into the datagram
+  auto *sbuff = reinterpret_cast<const E131RawPacket *>(data);
 
   if (memcmp(sbuff->acn_id, ACN_ID, sizeof(sbuff->acn_id)) != 0)
-    return false;
+    return pixel_protocol::PIXEL_PACKET_INVALID;
+  if (htonl(sbuff->root_vector) == VECTOR_ROOT_EXTENDED) {
+    if (htonl(sbuff->frame_vector) == VECTOR_FRAME_SYNCHRONIZATION)
+      return pixel_protocol::PIXEL_PACKET_SYNC;
+    return pixel_protocol::PIXEL_PACKET_IGNORED;
+  }
+  if (len < E131_MIN_PACKET_SIZE)
+    return pixel_protocol::PIXEL_PACKET_INVALID;
   if (htonl(sbuff->root_vector) != VECTOR_ROOT)
-    return false;
+    return pixel_protocol::PIXEL_PACKET_INVALID;
   if (htonl(sbuff->frame_vector) != VECTOR_FRAME)
-    return false;
+    return pixel_protocol::PIXEL_PACKET_INVALID;
   if (sbuff->dmp_vector != VECTOR_DMP)
-    return false;
+    return pixel_protocol::PIXEL_PACKET_INVALID;
   if (sbuff->property_values[0] != 0)
-    return false;
-
-  universe = htons(sbuff->universe);
-  packet.count = htons(sbuff->property_value_count);
-  if (packet.count > E131_MAX_PROPERTY_VALUES_COUNT)
-    return false;
-
-  memcpy(packet.values, sbuff->property_values, packet.count);
-  return true;
+    return pixel_protocol::PIXEL_PACKET_INVALID;
+
+  uint16_t count = htons(sbuff->property_value_count);
+  if (count == 0 || count > E131_MAX_PROPERTY_VALUES_COUNT)
+    return pixel_protocol::PIXEL_PACKET_INVALID;
+  // Never expose bytes past the end of a truncated datagram
+  count = std::min<size_t>(count, len - (E131_MIN_PACKET_SIZE - 1));
+
+  packet.universe = htons(sbuff->universe);
+  // Skip the start code
+  packet.values = sbuff->property_values + 1;
+  packet.count = count - 1;
+  packet.sequence = sbuff->sequence_number;
+  return pixel_protocol::PIXEL_PACKET_DATA;
 }
 
 }  // namespace e131
@@ -30,6 +30,14 @@ void ESP32RMTLEDStripLightOutput::setup() {
     return;
   }
 
+  // The translator reads this copy while transmitting, so effects writing the LED buffer don't tear the frame
+  this->tx_buf_ = allocator.allocate(buffer_size);
+  if (this->tx_buf_ == nullptr) {
+    ESP_LOGE(TAG, "Cannot allocate LED transmit buffer!");
+    this->mark_failed();
+    return;
+  }
+
   this->effect_data_ = allocator.allocate(this->num_leds_);
   if (this->effect_data_ == nullptr) {
     ESP_LOGE(TAG, "Cannot allocate effect data!");
@@ -37,16 +45,13 @@ void ESP32RMTLEDStripLightOutput::setup() {
     return;
   }
 
-  RAMAllocator<rmt_item32_t> rmt_allocator(this->use_psram_ ? 0 : RAMAllocator<rmt_item32_t>::ALLOC_INTERNAL);
-  this->rmt_buf_ = rmt_allocator.allocate(buffer_size * 8 +
-                                          1);  // 8 bits per byte, 1 rmt_item32_t per bit + 1 rmt_item32_t for reset
-
   rmt_config_t config;
   memset(&config, 0, sizeof(config));
   config.channel = this->channel_;
   config.rmt_mode = RMT_MODE_TX;
   config.gpio_num = gpio_num_t(this->pin_);
-  config.mem_block_num = 1;
+  // More memory blocks give the translator more time to refill the channel memory
+  config.mem_block_num = this->mem_blocks_;
   config.clk_div = RMT_CLK_DIV;
   config.tx_config.loop_en = false;
   config.tx_config.carrier_level = RMT_CARRIER_LEVEL_LOW;
@@ -64,6 +69,41 @@ void ESP32RMTLEDStripLightOutput::setup() {
     this->mark_failed();
     return;
   }
+  // LED data is encoded into RMT items on demand while transmitting, instead of expanding the whole strip up front
+  if (rmt_translator_init(config.channel, encode_) != ESP_OK ||
+      rmt_translator_set_context(config.channel, this) != ESP_OK) {
+    ESP_LOGE(TAG, "Cannot install RMT translator!");
+    this->mark_failed();
+    return;
+  }
+}
+
+void IRAM_ATTR ESP32RMTLEDStripLightOutput::encode_(const void *src, rmt_item32_t *dest, size_t src_size,
+                                                    size_t wanted_num, size_t *translated_size, size_t *item_num) {
+  void *context = nullptr;
+  rmt_translator_get_context(item_num, &context);
+  auto *self = static_cast<ESP32RMTLEDStripLightOutput *>(context);
+  const uint8_t *psrc = static_cast<const uint8_t *>(src);
+  bool reset = self->reset_.duration0 > 0 || self->reset_.duration1 > 0;
+
+  size_t size = 0;
+  size_t num = 0;
+  while (size < src_size && num + 8 <= wanted_num) {
+    // the last byte is only encoded together with the reset item
+    if (reset && size + 1 == src_size && num + 9 > wanted_num)
+      break;
+    uint8_t b = psrc[size];
+    memcpy(dest + num, self->nibble_items_[b >> 4], sizeof(self->nibble_items_[0]));
+    memcpy(dest + num + 4, self->nibble_items_[b & 0x0F], sizeof(self->nibble_items_[0]));
+    num += 8;
+    size++;
+  }
+  if (reset && size == src_size && num < wanted_num) {
+    dest[num++] = self->reset_;
+  }
+
+  *translated_size = size;
+  *item_num = num;
 }
 
 void ESP32RMTLEDStripLightOutput::set_led_params(uint32_t bit0_high, uint32_t bit0_low, uint32_t bit1_high,
@@ -85,6 +125,12 @@ void ESP32RMTLEDStripLightOutput::set_led_params(uint32_t bit0_high, uint32_t bi
   this->reset_.level0 = 1;
   this->reset_.duration1 = (uint32_t) (ratio * reset_time_low);
   this->reset_.level1 = 0;
+
+  for (uint8_t nibble = 0; nibble < 16; nibble++) {
+    for (uint8_t i = 0; i < 4; i++) {
+      this->nibble_items_[nibble][i] = nibble & (8 >> i) ? this->bit1_ : this->bit0_;
+    }
+  }
 }
 
 void ESP32RMTLEDStripLightOutput::write_state(light::LightState *state) {
@@ -107,30 +153,8 @@ void ESP32RMTLEDStripLightOutput::write_state(light::LightState *state) {
   }
   delayMicroseconds(50);
 
-  size_t buffer_size = this->get_buffer_size_();
-
-  size_t size = 0;
-  size_t len = 0;
-  uint8_t *psrc = this->buf_;
-  rmt_item32_t *pdest = this->rmt_buf_;
-  while (size < buffer_size) {
-    uint8_t b = *psrc;
-    for (int i = 0; i < 8; i++) {
-      pdest->val = b & (1 << (7 - i)) ? this->bit1_.val : this->bit0_.val;
-      pdest++;
-      len++;
-    }
-    size++;
-    psrc++;
-  }
-
-  if (this->reset_.duration0 > 0 || this->reset_.duration1 > 0) {
-    pdest->val = this->reset_.val;
-    pdest++;
-    len++;
-  }
-
-  if (rmt_write_items(this->channel_, this->rmt_buf_, len, false) != ESP_OK) {
+  memcpy(this->tx_buf_, this->buf_, this->get_buffer_size_());
+  if (rmt_write_sample(this->channel_, this->tx_buf_, this->get_buffer_size_(), false) != ESP_OK) {
     ESP_LOGE(TAG, "RMT TX error");
     this->status_set_warning();
     return;
@@ -187,6 +211,7 @@ void ESP32RMTLEDStripLightOutput::dump_config() {
   ESP_LOGCONFIG(TAG, "ESP32 RMT LED Strip:");
   ESP_LOGCONFIG(TAG, "  Pin: %u", this->pin_);
   ESP_LOGCONFIG(TAG, "  Channel: %u", this->channel_);
+  ESP_LOGCONFIG(TAG, "  RMT memory blocks: %u", this->mem_blocks_);
   const char *rgb_order;
   switch (this->rgb_order_) {
     case ORDER_RGB:
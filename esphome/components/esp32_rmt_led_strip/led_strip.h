@@ -55,6 +55,8 @@ class ESP32RMTLEDStripLightOutput : public light::AddressableLight {
 
   void set_rgb_order(RGBOrder rgb_order) { this->rgb_order_ = rgb_order; }
   void set_rmt_channel(rmt_channel_t channel) { this->channel_ = channel; }
+  /// Number of RMT memory blocks, including those borrowed from the following channels, which must not be in use.
+  void set_rmt_mem_blocks(uint8_t mem_blocks) { this->mem_blocks_ = mem_blocks; }
 
   void clear_effect_data() override {
     for (int i = 0; i < this->size(); i++)
@@ -65,12 +67,17 @@ class ESP32RMTLEDStripLightOutput : public light::AddressableLight {
 
  protected:
   light::ESPColorView get_view_internal(int32_t index) const override;
+  bool has_flat_buffer_() const override { return true; }
 
   size_t get_buffer_size_() const { return this->num_leds_ * (this->is_rgbw_ || this->is_wrgb_ ? 4 : 3); }
 
+  /// RMT translator, called from the RMT interrupt to encode the next part of the LED buffer.
+  static void encode_(const void *src, rmt_item32_t *dest, size_t src_size, size_t wanted_num,
+                      size_t *translated_size, size_t *item_num);
+
   uint8_t *buf_{nullptr};
+  uint8_t *tx_buf_{nullptr};
   uint8_t *effect_data_{nullptr};
-  rmt_item32_t *rmt_buf_{nullptr};
 
   uint8_t pin_;
   uint16_t num_leds_;
@@ -79,8 +86,11 @@ class ESP32RMTLEDStripLightOutput : public light::AddressableLight {
   bool use_psram_;
 
   rmt_item32_t bit0_, bit1_, reset_;
+  // RMT items of every 4-bit value, most significant bit first
+  rmt_item32_t nibble_items_[16][4];
   RGBOrder rgb_order_;
   rmt_channel_t channel_;
+  uint8_t mem_blocks_{1};
 
   uint32_t last_refresh_{0};
   optional<uint32_t> max_refresh_rate_{};
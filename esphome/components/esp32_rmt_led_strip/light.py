@@ -2,15 +2,18 @@ from dataclasses import dataclass
 
 import esphome.codegen as cg
 import esphome.config_validation as cv
+import esphome.final_validate as fv
 from esphome import pins
-from esphome.components import esp32_rmt, light
+from esphome.components import esp32, esp32_rmt, light
 from esphome.const import (
     CONF_CHIPSET,
     CONF_IS_RGBW,
     CONF_MAX_REFRESH_RATE,
+    CONF_MEMORY_BLOCKS,
     CONF_NUM_LEDS,
     CONF_OUTPUT_ID,
     CONF_PIN,
+    CONF_PLATFORM,
     CONF_RGB_ORDER,
     CONF_RMT_CHANNEL,
 )
@@ -65,6 +68,18 @@ CONF_RESET_HIGH = "reset_high"
 CONF_RESET_LOW = "reset_low"
 
 
+def _validate_memory_blocks(config):
+    # Additional blocks are borrowed from the following channels, which must be able to transmit too
+    channel = config[CONF_RMT_CHANNEL]
+    last_channel = max(esp32_rmt.RMT_TX_CHANNELS[esp32.get_esp32_variant()])
+    if channel + config[CONF_MEMORY_BLOCKS] - 1 > last_channel:
+        raise cv.Invalid(
+            f"RMT channel {channel} can use at most {last_channel - channel + 1} memory blocks",
+            [CONF_MEMORY_BLOCKS],
+        )
+    return config
+
+
 CONFIG_SCHEMA = cv.All(
     light.ADDRESSABLE_LIGHT_SCHEMA.extend(
         {
@@ -73,6 +88,7 @@ CONFIG_SCHEMA = cv.All(
             cv.Required(CONF_NUM_LEDS): cv.positive_not_null_int,
             cv.Required(CONF_RGB_ORDER): cv.enum(RGB_ORDERS, upper=True),
             cv.Required(CONF_RMT_CHANNEL): esp32_rmt.validate_rmt_channel(tx=True),
+            cv.Optional(CONF_MEMORY_BLOCKS, default=1): cv.int_range(min=1, max=8),
             cv.Optional(CONF_MAX_REFRESH_RATE): cv.positive_time_period_microseconds,
             cv.Optional(CONF_CHIPSET): cv.one_of(*CHIPSETS, upper=True),
             cv.Optional(CONF_IS_RGBW, default=False): cv.boolean,
@@ -105,9 +121,47 @@ CONFIG_SCHEMA = cv.All(
         }
     ),
     cv.has_exactly_one_key(CONF_CHIPSET, CONF_BIT0_HIGH),
+    _validate_memory_blocks,
 )
 
 
+def _final_validate(config):
+    borrowed = range(
+        config[CONF_RMT_CHANNEL] + 1,
+        config[CONF_RMT_CHANNEL] + config[CONF_MEMORY_BLOCKS],
+    )
+    if not borrowed:
+        return config
+    full_config = fv.full_config.get()
+    # Memory blocks of every other RMT user with a fixed channel
+    users = [
+        (conf[CONF_RMT_CHANNEL], conf[CONF_MEMORY_BLOCKS])
+        for conf in full_config.get("light", [])
+        if conf.get(CONF_PLATFORM) == "esp32_rmt_led_strip"
+        and conf[CONF_OUTPUT_ID].id != config[CONF_OUTPUT_ID].id
+    ]
+    users += [
+        (conf[CONF_RMT_CHANNEL], 1)
+        for conf in full_config.get("remote_transmitter", [])
+        if CONF_RMT_CHANNEL in conf
+    ]
+    users += [
+        (conf[CONF_RMT_CHANNEL], conf[CONF_MEMORY_BLOCKS])
+        for conf in full_config.get("remote_receiver", [])
+        if CONF_RMT_CHANNEL in conf
+    ]
+    for channel, blocks in users:
+        if any(channel <= block < channel + blocks for block in borrowed):
+            raise cv.Invalid(
+                f"The memory blocks of RMT channel {config[CONF_RMT_CHANNEL]} overlap with RMT channel {channel}",
+                [CONF_MEMORY_BLOCKS],
+            )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_OUTPUT_ID])
     await light.register_light(var, config)
@@ -153,3 +207,4 @@ async def to_code(config):
             getattr(rmt_channel_t, f"RMT_CHANNEL_{config[CONF_RMT_CHANNEL]}")
         )
     )
+    cg.add(var.set_rmt_mem_blocks(config[CONF_MEMORY_BLOCKS]))
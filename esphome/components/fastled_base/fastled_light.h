@@ -224,6 +224,7 @@ class FastLEDLightOutput : public light::AddressableLight {
   }
 
  protected:
+  bool has_flat_buffer_() const override { return true; }
   light::ESPColorView get_view_internal(int32_t index) const override {
     return {&this->leds_[index].r,      &this->leds_[index].g, &this->leds_[index].b, nullptr,
             &this->effect_data_[index], &this->correction_};
@@ -41,6 +41,7 @@ Glyph = font_ns.class_("Glyph")
 GlyphData = font_ns.struct("GlyphData")
 
 CONF_BPP = "bpp"
+CONF_COMPRESS = "compress"
 CONF_EXTRAS = "extras"
 CONF_FONTS = "fonts"
 
@@ -315,6 +316,7 @@ FONT_SCHEMA = cv.Schema(
         cv.Optional(CONF_GLYPHS, default=DEFAULT_GLYPHS): validate_glyphs,
         cv.Optional(CONF_SIZE, default=20): cv.int_range(min=1),
         cv.Optional(CONF_BPP, default=1): cv.one_of(1, 2, 4, 8),
+        cv.Optional(CONF_COMPRESS, default=False): cv.boolean,
         cv.Optional(CONF_EXTRAS): cv.ensure_list(
             cv.Schema(
                 {
@@ -446,6 +448,47 @@ def load_ttf_font(path, size):
     return TrueTypeFontWrapper(font)
 
 
+# Run opcodes of the compressed glyph format, must match font.cpp. The low 6 bits
+# hold the run length minus one. Runs never cross a row.
+RLE_TRANSPARENT = 0x00
+RLE_FULL = 0x40
+RLE_LITERAL = 0x80
+RLE_MAX_RUN = 64
+
+
+def pack_pixels(pixels, bpp):
+    """Pack pixel values MSB first with bpp bits each, as the uncompressed format does."""
+    data = [0] * ((len(pixels) * bpp + 7) // 8)
+    pos = 0
+    for pixel in pixels:
+        for bit_num in range(bpp):
+            if pixel & (1 << (bpp - bit_num - 1)):
+                data[pos // 8] |= 0x80 >> (pos % 8)
+            pos += 1
+    return data
+
+
+def rle_encode_row(row, bpp):
+    """Encode one glyph row as runs of empty, fully covered and literal pixels."""
+    full = (1 << bpp) - 1
+    data = []
+    x = 0
+    while x < len(row):
+        value = row[x]
+        end = x + 1
+        if value in (0, full):
+            while end < len(row) and row[end] == value and end - x < RLE_MAX_RUN:
+                end += 1
+            data.append((RLE_TRANSPARENT if value == 0 else RLE_FULL) | (end - x - 1))
+        else:
+            while end < len(row) and 0 < row[end] < full and end - x < RLE_MAX_RUN:
+                end += 1
+            data.append(RLE_LITERAL | (end - x - 1))
+            data += pack_pixels(row[x:end], bpp)
+        x = end
+    return data
+
+
 class GlyphInfo:
     def __init__(self, data_len, offset_x, offset_y, width, height):
         self.data_len = data_len
@@ -465,7 +508,6 @@ async def to_code(config):
             glyph_to_font_map[glyph] = font
     glyphs.sort(key=functools.cmp_to_key(glyph_comparator))
     glyph_args = {}
-    data = []
     bpp = config[CONF_BPP]
     if bpp == 1:
         mode = "1"
@@ -473,22 +515,49 @@ async def to_code(config):
     else:
         mode = "L"
         scale = 256 // (1 << bpp)
+    full = (1 << bpp) - 1
+    glyph_sizes = {}
+    glyph_rows = {}
     for glyph in glyphs:
         font = glyph_to_font_map[glyph].font
         mask = font.getmask(glyph, mode=mode)
-        offset_x, offset_y = font.getoffset(glyph)
         width, height = mask.size
-        glyph_data = [0] * ((height * width * bpp + 7) // 8)
-        pos = 0
-        for y in range(height):
-            for x in range(width):
-                pixel = mask.getpixel((x, y)) // scale
-                for bit_num in range(bpp):
-                    if pixel & (1 << (bpp - bit_num - 1)):
-                        glyph_data[pos // 8] |= 0x80 >> (pos % 8)
-                    pos += 1
+        glyph_sizes[glyph] = width, height
+        glyph_rows[glyph] = [
+            [(mask.getpixel((x, y)) // scale) & full for x in range(width)]
+            for y in range(height)
+        ]
+
+    raw = {
+        glyph: pack_pixels([pixel for row in rows for pixel in row], bpp)
+        for glyph, rows in glyph_rows.items()
+    }
+    compress = False
+    if config[CONF_COMPRESS]:
+        encoded = {
+            glyph: [byte for row in rows for byte in rle_encode_row(row, bpp)]
+            for glyph, rows in glyph_rows.items()
+        }
+        raw_size = sum(len(x) for x in raw.values())
+        encoded_size = sum(len(x) for x in encoded.values())
+        if encoded_size < raw_size:
+            compress = True
+            raw = encoded
+        else:
+            _LOGGER.info(
+                "Font %s: compressed glyphs (%d bytes) are not smaller than raw glyphs (%d bytes), storing raw",
+                config[CONF_ID],
+                encoded_size,
+                raw_size,
+            )
+
+    data = []
+    for glyph in glyphs:
+        font = glyph_to_font_map[glyph].font
+        offset_x, offset_y = font.getoffset(glyph)
+        width, height = glyph_sizes[glyph]
         glyph_args[glyph] = GlyphInfo(len(data), offset_x, offset_y, width, height)
-        data += glyph_data
+        data += raw[glyph]
 
     rhs = [HexInt(x) for x in data]
     prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
@@ -517,7 +586,7 @@ async def to_code(config):
 
     glyphs = cg.static_const_array(config[CONF_RAW_GLYPH_ID], glyph_initializer)
 
-    cg.new_Pvariable(
+    var = cg.new_Pvariable(
         config[CONF_ID],
         glyphs,
         len(glyph_initializer),
@@ -525,3 +594,5 @@ async def to_code(config):
         font_list[0].ascent + font_list[0].descent,
         bpp,
     )
+    if compress:
+        cg.add(var.set_compressed(True))
@@ -1,5 +1,7 @@
 #include "font.h"
 
+#include <cstring>
+
 #include "esphome/core/color.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
@@ -9,6 +11,50 @@ namespace font {
 
 static const char *const TAG = "font";
 
+/// Number of recently drawn strings whose layout is kept per font.
+static const size_t RUN_CACHE_SIZE = 4;
+/// Longer strings are laid out every time instead of taking a cache slot.
+static const size_t MAX_CACHED_RUN_LENGTH = 64;
+static const int16_t CODEPOINT_NO_GLYPH = -1;
+static const int16_t CODEPOINT_SEARCH = -2;
+
+// Run opcodes of compressed glyphs, see rle_encode_row() in __init__.py. Each glyph row is a sequence of runs, the
+// low bits hold the run length minus one and literal runs are followed by their packed pixel values.
+static const uint8_t RLE_OP_MASK = 0xC0;
+static const uint8_t RLE_LENGTH_MASK = 0x3F;
+static const uint8_t RLE_TRANSPARENT = 0x00;
+static const uint8_t RLE_FULL = 0x40;
+static const uint8_t RLE_LITERAL = 0x80;
+
+// Read the next bpp bit pixel value, MSB first, from packed glyph data.
+static inline uint8_t read_packed_pixel(const uint8_t *&data, uint8_t &bitmask, uint8_t &pixel_data, uint8_t bpp) {
+  uint8_t pixel = 0;
+  for (int bit_num = 0; bit_num != bpp; bit_num++) {
+    if (bitmask == 0) {
+      pixel_data = progmem_read_byte(data++);
+      bitmask = 0x80;
+    }
+    pixel <<= 1;
+    if ((pixel_data & bitmask) != 0)
+      pixel |= 1;
+    bitmask >>= 1;
+  }
+  return pixel;
+}
+
+// Decode the UTF-8 sequence at str if it is a Latin-1 codepoint, return -1 otherwise.
+static int decode_latin1(const uint8_t *str, int *length) {
+  if (str[0] < 0x80) {
+    *length = 1;
+    return str[0];
+  }
+  if ((str[0] == 0xC2 || str[0] == 0xC3) && (str[1] & 0xC0) == 0x80) {
+    *length = 2;
+    return ((str[0] & 0x1F) << 6) | (str[1] & 0x3F);
+  }
+  return -1;
+}
+
 const uint8_t *Glyph::get_char() const { return this->glyph_data_->a_char; }
 // Compare the char at the string position with this char.
 // Return true if this char is less than or equal the other.
@@ -48,10 +94,77 @@ void Glyph::scan_area(int *x1, int *y1, int *width, int *height) const {
 Font::Font(const GlyphData *data, int data_nr, int baseline, int height, uint8_t bpp)
     : baseline_(baseline), height_(height), bpp_(bpp) {
   glyphs_.reserve(data_nr);
-  for (int i = 0; i < data_nr; ++i)
+  for (int i = 0; i < data_nr; ++i) {
     glyphs_.emplace_back(&data[i]);
+    int length;
+    int code = decode_latin1(data[i].a_char, &length);
+    if (code < 0)
+      continue;
+    if (code >= (int) this->codepoint_index_.size())
+      this->codepoint_index_.resize(code + 1, CODEPOINT_NO_GLYPH);
+    if (data[i].a_char[length] != '\0') {
+      // a multi character glyph may be the longer match, leave it to the binary search
+      this->codepoint_index_[code] = CODEPOINT_SEARCH;
+    } else if (this->codepoint_index_[code] != CODEPOINT_SEARCH) {
+      this->codepoint_index_[code] = i;
+    }
+  }
+}
+void Font::decode_glyph(const GlyphData *glyph_data, uint8_t *bitmap) const {
+  const size_t bitmap_length = (glyph_data->width * glyph_data->height * this->bpp_ + 7) / 8;
+  if (!this->compressed_) {
+    for (size_t i = 0; i != bitmap_length; i++)
+      bitmap[i] = progmem_read_byte(glyph_data->data + i);
+    return;
+  }
+  memset(bitmap, 0, bitmap_length);
+  const uint8_t *data = glyph_data->data;
+  const uint8_t full = (1 << this->bpp_) - 1;
+  size_t pos = 0;  // bit position in the bitmap
+  auto put = [&](uint8_t pixel) {
+    for (int bit_num = this->bpp_ - 1; bit_num >= 0; bit_num--, pos++) {
+      if (pixel & (1 << bit_num))
+        bitmap[pos / 8] |= 0x80 >> (pos % 8);
+    }
+  };
+  for (int y = 0; y != glyph_data->height; y++) {
+    int x = 0;
+    while (x < glyph_data->width) {
+      const uint8_t op = progmem_read_byte(data++);
+      const int length = (op & RLE_LENGTH_MASK) + 1;
+      uint8_t bitmask = 0;
+      uint8_t pixel_data = 0;
+      for (int i = 0; i != length; i++) {
+        switch (op & RLE_OP_MASK) {
+          case RLE_FULL:
+            put(full);
+            break;
+          case RLE_LITERAL:
+            put(read_packed_pixel(data, bitmask, pixel_data, this->bpp_));
+            break;
+          default:
+            pos += this->bpp_;
+            break;
+        }
+      }
+      x += length;
+    }
+  }
 }
 int Font::match_next_glyph(const uint8_t *str, int *match_length) {
+  int length;
+  int code = decode_latin1(str, &length);
+  if (code >= 0 && code < (int) this->codepoint_index_.size()) {
+    int16_t index = this->codepoint_index_[code];
+    if (index == CODEPOINT_NO_GLYPH) {
+      *match_length = 0;
+      return -1;
+    }
+    if (index != CODEPOINT_SEARCH) {
+      *match_length = length;
+      return index;
+    }
+  }
   int lo = 0;
   int hi = this->glyphs_.size() - 1;
   while (lo != hi) {
@@ -68,20 +181,40 @@ int Font::match_next_glyph(const uint8_t *str, int *match_length) {
   return lo;
 }
 #ifdef USE_DISPLAY
-void Font::measure(const char *str, int *width, int *x_offset, int *baseline, int *height) {
-  *baseline = this->baseline_;
-  *height = this->height_;
+const ShapedRun &Font::shape_(const char *text) {
+  const size_t text_length = strlen(text);
+  for (auto &run : this->run_cache_) {
+    if (run.text.size() == text_length && memcmp(run.text.data(), text, text_length) == 0)
+      return run;
+  }
+
+  ShapedRun *run;
+  if (text_length > MAX_CACHED_RUN_LENGTH) {
+    run = &this->scratch_run_;
+  } else if (this->run_cache_.size() < RUN_CACHE_SIZE) {
+    this->run_cache_.reserve(RUN_CACHE_SIZE);
+    this->run_cache_.emplace_back();
+    run = &this->run_cache_.back();
+  } else {
+    run = &this->run_cache_[this->next_run_];
+    this->next_run_ = (this->next_run_ + 1) % RUN_CACHE_SIZE;
+  }
+  run->text.assign(text, text_length);
+  run->glyphs.clear();
+
   int i = 0;
   int min_x = 0;
   bool has_char = false;
   int x = 0;
-  while (str[i] != '\0') {
+  while (text[i] != '\0') {
     int match_length;
-    int glyph_n = this->match_next_glyph((const uint8_t *) str + i, &match_length);
+    int glyph_n = this->match_next_glyph((const uint8_t *) text + i, &match_length);
     if (glyph_n < 0) {
       // Unknown char, skip
+      ESP_LOGW(TAG, "Encountered character without representation in font: '%c'", text[i]);
       if (!this->get_glyphs().empty())
         x += this->get_glyphs()[0].glyph_data_->width;
+      run->glyphs.push_back(-1);
       i++;
       continue;
     }
@@ -93,30 +226,32 @@ void Font::measure(const char *str, int *width, int *x_offset, int *baseline, in
       min_x = std::min(min_x, x + glyph.glyph_data_->offset_x);
     }
     x += glyph.glyph_data_->width + glyph.glyph_data_->offset_x;
+    run->glyphs.push_back(glyph_n);
 
     i += match_length;
     has_char = true;
   }
-  *x_offset = min_x;
-  *width = x - min_x;
+  run->x_offset = min_x;
+  run->width = x - min_x;
+  return *run;
+}
+void Font::measure(const char *str, int *width, int *x_offset, int *baseline, int *height) {
+  const ShapedRun &run = this->shape_(str);
+  *baseline = this->baseline_;
+  *height = this->height_;
+  *x_offset = run.x_offset;
+  *width = run.width;
 }
 void Font::print(int x_start, int y_start, display::Display *display, Color color, const char *text, Color background) {
-  int i = 0;
   int x_at = x_start;
   int scan_x1, scan_y1, scan_width, scan_height;
-  while (text[i] != '\0') {
-    int match_length;
-    int glyph_n = this->match_next_glyph((const uint8_t *) text + i, &match_length);
+  for (int16_t glyph_n : this->shape_(text).glyphs) {
     if (glyph_n < 0) {
-      // Unknown char, skip
-      ESP_LOGW(TAG, "Encountered character without representation in font: '%c'", text[i]);
       if (!this->get_glyphs().empty()) {
         uint8_t glyph_width = this->get_glyphs()[0].glyph_data_->width;
         display->filled_rectangle(x_at, y_start, glyph_width, this->height_, color);
         x_at += glyph_width;
       }
-
-      i++;
       continue;
     }
 
@@ -135,33 +270,61 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
     auto diff_b = (float) color.b - (float) background.b;
     auto b_r = (float) background.r;
     auto b_g = (float) background.g;
-    auto b_b = (float) background.g;
-    for (int glyph_y = y_start + scan_y1; glyph_y != max_y; glyph_y++) {
-      for (int glyph_x = x_at + scan_x1; glyph_x != max_x; glyph_x++) {
-        uint8_t pixel = 0;
-        for (int bit_num = 0; bit_num != this->bpp_; bit_num++) {
-          if (bitmask == 0) {
-            pixel_data = progmem_read_byte(data++);
-            bitmask = 0x80;
+    auto b_b = (float) background.b;
+    auto blend = [&](uint8_t pixel) {
+      auto on = (float) pixel / (float) bpp_max;
+      return Color((uint8_t) (diff_r * on + b_r), (uint8_t) (diff_g * on + b_g), (uint8_t) (diff_b * on + b_b));
+    };
+
+    if (this->compressed_) {
+      // Full runs become spans directly, only literal runs carry per pixel coverage.
+      for (int glyph_y = y_start + scan_y1; glyph_y != max_y; glyph_y++) {
+        int glyph_x = x_at + scan_x1;
+        while (glyph_x < max_x) {
+          const uint8_t op = progmem_read_byte(data++);
+          const int length = (op & RLE_LENGTH_MASK) + 1;
+          if ((op & RLE_OP_MASK) == RLE_FULL) {
+            display->horizontal_line(glyph_x, glyph_y, length, color);
+          } else if ((op & RLE_OP_MASK) == RLE_LITERAL) {
+            bitmask = 0;
+            for (int i = 0; i != length; i++) {
+              uint8_t pixel = read_packed_pixel(data, bitmask, pixel_data, this->bpp_);
+              if (pixel == bpp_max) {
+                display->draw_pixel_at(glyph_x + i, glyph_y, color);
+              } else if (pixel != 0) {
+                display->draw_pixel_at(glyph_x + i, glyph_y, blend(pixel));
+              }
+            }
           }
-          pixel <<= 1;
-          if ((pixel_data & bitmask) != 0)
-            pixel |= 1;
-          bitmask >>= 1;
+          glyph_x += length;
         }
+      }
+      x_at += glyph.glyph_data_->width + glyph.glyph_data_->offset_x;
+      continue;
+    }
+
+    for (int glyph_y = y_start + scan_y1; glyph_y != max_y; glyph_y++) {
+      // Fully covered pixels are collected into runs and drawn as spans, only anti-aliased edges go per pixel.
+      int run_start = 0;
+      int run_length = 0;
+      for (int glyph_x = x_at + scan_x1; glyph_x != max_x; glyph_x++) {
+        uint8_t pixel = read_packed_pixel(data, bitmask, pixel_data, this->bpp_);
         if (pixel == bpp_max) {
-          display->draw_pixel_at(glyph_x, glyph_y, color);
-        } else if (pixel != 0) {
-          auto on = (float) pixel / (float) bpp_max;
-          auto blended =
-              Color((uint8_t) (diff_r * on + b_r), (uint8_t) (diff_g * on + b_g), (uint8_t) (diff_b * on + b_b));
-          display->draw_pixel_at(glyph_x, glyph_y, blended);
+          if (run_length++ == 0)
+            run_start = glyph_x;
+          continue;
         }
+        if (run_length != 0) {
+          display->horizontal_line(run_start, glyph_y, run_length, color);
+          run_length = 0;
+        }
+        if (pixel != 0)
+          display->draw_pixel_at(glyph_x, glyph_y, blend(pixel));
       }
+      if (run_length != 0)
+        display->horizontal_line(run_start, glyph_y, run_length, color);
     }
     x_at += glyph.glyph_data_->width + glyph.glyph_data_->offset_x;
-
-    i += match_length;
   }
 }
 #endif
@@ -41,6 +41,14 @@ class Glyph {
   const GlyphData *glyph_data_;
 };
 
+/// Glyphs and horizontal extent of a string as laid out by a font.
+struct ShapedRun {
+  std::string text;
+  std::vector<int16_t> glyphs;  ///< Index into the glyph list, -1 for characters the font does not contain.
+  int width;
+  int x_offset;
+};
+
 class Font
 #ifdef USE_DISPLAY
     : public display::BaseFont
@@ -66,13 +74,34 @@ class Font
   inline int get_height() { return this->height_; }
   inline int get_bpp() { return this->bpp_; }
 
+  /// Glyph data is run-length encoded per row instead of a plain bitmap, set by code generation.
+  void set_compressed(bool compressed) { this->compressed_ = compressed; }
+  bool is_compressed() const { return this->compressed_; }
+  /// Write the plain bpp-packed bitmap of a glyph of this font to bitmap, which must hold
+  /// (width * height * bpp + 7) / 8 bytes.
+  void decode_glyph(const GlyphData *glyph_data, uint8_t *bitmap) const;
+
   const std::vector<Glyph, ExternalRAMAllocator<Glyph>> &get_glyphs() const { return glyphs_; }
 
  protected:
+#ifdef USE_DISPLAY
+  /// Lay out text, reusing the result of a recent call with the same string.
+  const ShapedRun &shape_(const char *text);
+#endif
+
   std::vector<Glyph, ExternalRAMAllocator<Glyph>> glyphs_;
+  /// Glyph index per Latin-1 codepoint so common characters skip the binary search.
+  /// -1 means no glyph starts with the codepoint, -2 that a longer glyph does and the search is needed.
+  std::vector<int16_t> codepoint_index_;
+#ifdef USE_DISPLAY
+  std::vector<ShapedRun> run_cache_;
+  ShapedRun scratch_run_;
+  uint8_t next_run_{0};
+#endif
   int baseline_;
   int height_;
   uint8_t bpp_;  // bits per pixel
+  bool compressed_{false};
 };
 
 }  // namespace font
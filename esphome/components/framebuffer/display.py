@@ -0,0 +1,81 @@
+from esphome import automation
+import esphome.codegen as cg
+from esphome.components import display
+import esphome.config_validation as cv
+from esphome.const import (
+    CONF_DIMENSIONS,
+    CONF_HEIGHT,
+    CONF_ID,
+    CONF_LAMBDA,
+    CONF_PATH,
+    CONF_WIDTH,
+    PLATFORM_HOST,
+)
+
+framebuffer_ns = cg.esphome_ns.namespace("framebuffer")
+Framebuffer = framebuffer_ns.class_("Framebuffer", display.DisplayBuffer)
+SavePngAction = framebuffer_ns.class_(
+    "SavePngAction", automation.Action, cg.Parented.template(Framebuffer)
+)
+
+CONF_SNAPSHOT_PATH = "snapshot_path"
+
+CONFIG_SCHEMA = cv.All(
+    display.FULL_DISPLAY_SCHEMA.extend(
+        cv.Schema(
+            {
+                cv.GenerateID(): cv.declare_id(Framebuffer),
+                cv.Required(CONF_DIMENSIONS): cv.Any(
+                    cv.dimensions,
+                    cv.Schema(
+                        {
+                            cv.Required(CONF_WIDTH): cv.int_,
+                            cv.Required(CONF_HEIGHT): cv.int_,
+                        }
+                    ),
+                ),
+                cv.Optional(CONF_SNAPSHOT_PATH): cv.string,
+            }
+        )
+    ),
+    cv.only_on(PLATFORM_HOST),
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await display.register_display(var, config)
+
+    dimensions = config[CONF_DIMENSIONS]
+    if isinstance(dimensions, dict):
+        cg.add(var.set_dimensions(dimensions[CONF_WIDTH], dimensions[CONF_HEIGHT]))
+    else:
+        (width, height) = dimensions
+        cg.add(var.set_dimensions(width, height))
+
+    if snapshot_path := config.get(CONF_SNAPSHOT_PATH):
+        cg.add(var.set_snapshot_path(snapshot_path))
+
+    if lamb := config.get(CONF_LAMBDA):
+        lambda_ = await cg.process_lambda(
+            lamb, [(display.DisplayRef, "it")], return_type=cg.void
+        )
+        cg.add(var.set_writer(lambda_))
+
+
+@automation.register_action(
+    "framebuffer.save_png",
+    SavePngAction,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(Framebuffer),
+            cv.Required(CONF_PATH): cv.templatable(cv.string),
+        }
+    ),
+)
+async def save_png_action_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    template_ = await cg.templatable(config[CONF_PATH], args, cg.std_string)
+    cg.add(var.set_path(template_))
+    return var
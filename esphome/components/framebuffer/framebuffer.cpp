@@ -0,0 +1,162 @@
+#ifdef USE_HOST
+#include "framebuffer.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace framebuffer {
+
+static const char *const TAG = "framebuffer";
+
+static const size_t BYTES_PER_PIXEL = 3;
+// Largest block of data that fits in one stored deflate block.
+static const size_t MAX_STORED_BLOCK = 65535;
+
+void Framebuffer::setup() {
+  this->init_internal_(this->width_ * this->height_ * BYTES_PER_PIXEL);
+  if (this->buffer_ == nullptr)
+    this->mark_failed();
+}
+
+void Framebuffer::dump_config() {
+  LOG_DISPLAY("", "Framebuffer", this);
+  if (!this->snapshot_path_.empty())
+    ESP_LOGCONFIG(TAG, "  Snapshot path: %s", this->snapshot_path_.c_str());
+}
+
+void Framebuffer::update() {
+  const uint32_t start = micros();
+  this->do_update_();
+  const uint32_t elapsed = micros() - start;
+  this->frame_count_++;
+  this->total_us_ += elapsed;
+  this->min_us_ = std::min(this->min_us_, elapsed);
+  this->max_us_ = std::max(this->max_us_, elapsed);
+  ESP_LOGD(TAG, "Frame %u rendered in %.3f ms (min %.3f, avg %.3f, max %.3f)", (unsigned) this->frame_count_,
+           elapsed / 1000.0f, this->min_us_ / 1000.0f, this->total_us_ / 1000.0f / this->frame_count_,
+           this->max_us_ / 1000.0f);
+  if (!this->snapshot_path_.empty())
+    this->save_png(this->snapshot_path_);
+}
+
+void HOT Framebuffer::draw_absolute_pixel_internal(int x, int y, Color color) {
+  if (x >= this->width_ || x < 0 || y >= this->height_ || y < 0)
+    return;
+  uint8_t *pixel = this->buffer_ + ((size_t) y * this->width_ + x) * BYTES_PER_PIXEL;
+  pixel[0] = color.r;
+  pixel[1] = color.g;
+  pixel[2] = color.b;
+}
+
+void HOT Framebuffer::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  const size_t stride = (size_t) this->width_ * BYTES_PER_PIXEL;
+  uint8_t *first = this->buffer_ + (size_t) y * stride + x * BYTES_PER_PIXEL;
+  for (int i = 0; i != width; i++) {
+    first[i * BYTES_PER_PIXEL + 0] = color.r;
+    first[i * BYTES_PER_PIXEL + 1] = color.g;
+    first[i * BYTES_PER_PIXEL + 2] = color.b;
+  }
+  for (int row = 1; row != height; row++)
+    memcpy(first + row * stride, first, width * BYTES_PER_PIXEL);
+}
+
+Color Framebuffer::get_pixel(int x, int y) const {
+  if (this->buffer_ == nullptr || x >= this->width_ || x < 0 || y >= this->height_ || y < 0)
+    return Color::BLACK;
+  const uint8_t *pixel = this->buffer_ + ((size_t) y * this->width_ + x) * BYTES_PER_PIXEL;
+  return Color(pixel[0], pixel[1], pixel[2]);
+}
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len) {
+  static uint32_t table[256];
+  if (table[1] == 0) {
+    for (uint32_t i = 0; i != 256; i++) {
+      uint32_t value = i;
+      for (int bit = 0; bit != 8; bit++)
+        value = (value & 1) ? 0xEDB88320 ^ (value >> 1) : value >> 1;
+      table[i] = value;
+    }
+  }
+  crc = ~crc;
+  for (size_t i = 0; i != len; i++)
+    crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+  return ~crc;
+}
+
+static void append_be32(std::vector<uint8_t> &out, uint32_t value) {
+  out.push_back(value >> 24);
+  out.push_back(value >> 16);
+  out.push_back(value >> 8);
+  out.push_back(value);
+}
+
+static void append_chunk(std::vector<uint8_t> &out, const char *type, const std::vector<uint8_t> &data) {
+  append_be32(out, data.size());
+  const size_t start = out.size();
+  out.insert(out.end(), type, type + 4);
+  out.insert(out.end(), data.begin(), data.end());
+  append_be32(out, crc32_update(0, out.data() + start, out.size() - start));
+}
+
+bool Framebuffer::save_png(const std::string &path) const {
+  if (this->buffer_ == nullptr)
+    return false;
+  // Scanlines, each prefixed with filter type 0 (none).
+  const size_t stride = (size_t) this->width_ * BYTES_PER_PIXEL;
+  std::vector<uint8_t> raw;
+  raw.reserve((stride + 1) * this->height_);
+  for (int y = 0; y != this->height_; y++) {
+    raw.push_back(0);
+    raw.insert(raw.end(), this->buffer_ + y * stride, this->buffer_ + (y + 1) * stride);
+  }
+
+  // zlib stream made of stored (uncompressed) deflate blocks; snapshots favour simplicity over size.
+  std::vector<uint8_t> idat = {0x78, 0x01};
+  uint32_t adler_a = 1, adler_b = 0;
+  for (size_t pos = 0; pos < raw.size(); pos += MAX_STORED_BLOCK) {
+    const size_t len = std::min(MAX_STORED_BLOCK, raw.size() - pos);
+    idat.push_back(pos + len == raw.size() ? 1 : 0);
+    idat.push_back(len);
+    idat.push_back(len >> 8);
+    idat.push_back(~len);
+    idat.push_back(~len >> 8);
+    idat.insert(idat.end(), raw.begin() + pos, raw.begin() + pos + len);
+    for (size_t i = pos; i != pos + len; i++) {
+      adler_a = (adler_a + raw[i]) % 65521;
+      adler_b = (adler_b + adler_a) % 65521;
+    }
+  }
+  append_be32(idat, (adler_b << 16) | adler_a);
+
+  std::vector<uint8_t> header;
+  append_be32(header, this->width_);
+  append_be32(header, this->height_);
+  header.insert(header.end(), {8, 2, 0, 0, 0});  // 8 bit RGB, no interlacing
+
+  std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  append_chunk(png, "IHDR", header);
+  append_chunk(png, "IDAT", idat);
+  append_chunk(png, "IEND", {});
+
+  FILE *file = fopen(path.c_str(), "wb");
+  if (file == nullptr) {
+    ESP_LOGW(TAG, "Could not open %s for writing", path.c_str());
+    return false;
+  }
+  const bool ok = fwrite(png.data(), 1, png.size(), file) == png.size();
+  fclose(file);
+  if (!ok)
+    ESP_LOGW(TAG, "Could not write %s", path.c_str());
+  return ok;
+}
+
+}  // namespace framebuffer
+}  // namespace esphome
+
+#endif  // USE_HOST
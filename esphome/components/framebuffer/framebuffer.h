@@ -0,0 +1,66 @@
+#pragma once
+
+#ifdef USE_HOST
+#include <string>
+
+#include "esphome/core/automation.h"
+#include "esphome/core/component.h"
+#include "esphome/components/display/display_buffer.h"
+
+namespace esphome {
+namespace framebuffer {
+
+/**
+ * A display for the host platform that renders into an RGB888 buffer in memory instead of a window.
+ *
+ * Every update logs how long rendering took, and the buffer can be written to a PNG file, so that
+ * rendering can be timed and checked on machines without a screen.
+ */
+class Framebuffer : public display::DisplayBuffer {
+ public:
+  display::DisplayType get_display_type() override { return display::DISPLAY_TYPE_COLOR; }
+  void setup() override;
+  void update() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::HARDWARE; }
+
+  void set_dimensions(uint16_t width, uint16_t height) {
+    this->width_ = width;
+    this->height_ = height;
+  }
+  /// Write a PNG snapshot to this path after every update.
+  void set_snapshot_path(const std::string &snapshot_path) { this->snapshot_path_ = snapshot_path; }
+
+  /// Read back a pixel in unrotated display coordinates.
+  Color get_pixel(int x, int y) const;
+  /// Write the current buffer content to a PNG file, returns false if the file could not be written.
+  bool save_png(const std::string &path) const;
+
+ protected:
+  int get_width_internal() override { return this->width_; }
+  int get_height_internal() override { return this->height_; }
+  void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_rect_internal(int x, int y, int width, int height, Color color) override;
+
+  int width_{};
+  int height_{};
+  std::string snapshot_path_{};
+
+  // Render time statistics, in microseconds
+  uint32_t frame_count_{};
+  uint64_t total_us_{};
+  uint32_t min_us_{UINT32_MAX};
+  uint32_t max_us_{};
+};
+
+template<typename... Ts> class SavePngAction : public Action<Ts...>, public Parented<Framebuffer> {
+ public:
+  TEMPLATABLE_VALUE(std::string, path)
+
+  void play(Ts... x) override { this->parent_->save_png(this->path_.value(x...)); }
+};
+
+}  // namespace framebuffer
+}  // namespace esphome
+
+#endif  // USE_HOST
@@ -15,9 +15,23 @@ using namespace display;
 static const char *const TAG = "graph";
 static const char *const TAGL = "graphlegend";
 
+static const int16_t NO_ROW = INT16_MIN;
+
+void HistoryBucket::add(float value) {
+  if (std::isnan(value))
+    return;
+  if (this->count == 0 || value < this->min)
+    this->min = value;
+  if (this->count == 0 || value > this->max)
+    this->max = value;
+  this->sum += value;
+  if (this->count < UINT16_MAX)
+    this->count++;
+}
+
 void HistoryData::init(int length) {
   this->length_ = length;
-  this->samples_.resize(length, NAN);
+  this->buckets_.resize(length);
   this->last_sample_ = millis();
 }
 
@@ -26,25 +40,36 @@ void HistoryData::take_sample(float data) {
   uint32_t dt = tm - last_sample_;
   last_sample_ = tm;
 
-  // Step data based on time
+  // Step data based on time, every sample inside a column is summarised into its bucket
   this->period_ += dt;
+  bool completed = false;
   while (this->period_ >= this->update_time_) {
-    this->samples_[this->count_] = data;
+    // Columns that received no samples of their own repeat the new value
+    if (!this->sampled_)
+      this->current_.add(data);
+    this->buckets_[this->count_] = this->current_;
+    this->current_ = HistoryBucket{};
+    this->sampled_ = false;
     this->period_ -= this->update_time_;
     this->count_ = (this->count_ + 1) % this->length_;
+    this->revision_++;
+    completed = true;
     ESP_LOGV(TAG, "Updating trace with value: %f", data);
   }
-  if (!std::isnan(data)) {
+  this->current_.add(data);
+  this->sampled_ = true;
+
+  if (completed) {
     // Recalc recent max/min
-    this->recent_min_ = data;
-    this->recent_max_ = data;
-    for (int i = 0; i < this->length_; i++) {
-      if (!std::isnan(this->samples_[i])) {
-        if (this->recent_max_ < this->samples_[i])
-          this->recent_max_ = this->samples_[i];
-        if (this->recent_min_ > this->samples_[i])
-          this->recent_min_ = this->samples_[i];
-      }
+    this->recent_min_ = NAN;
+    this->recent_max_ = NAN;
+    for (const auto &bucket : this->buckets_) {
+      if (bucket.count == 0)
+        continue;
+      if (std::isnan(this->recent_max_) || this->recent_max_ < bucket.max)
+        this->recent_max_ = bucket.max;
+      if (std::isnan(this->recent_min_) || this->recent_min_ > bucket.min)
+        this->recent_min_ = bucket.min;
     }
   }
 }
@@ -52,19 +77,13 @@ void HistoryData::take_sample(float data) {
 void GraphTrace::init(Graph *g) {
   ESP_LOGI(TAG, "Init trace for sensor %s", this->get_name().c_str());
   this->data_.init(g->get_width());
+  this->rows_.resize(g->get_width(), NO_ROW);
   sensor_->add_on_state_callback([this](float state) { this->data_.take_sample(state); });
   this->data_.set_update_time_ms(g->get_duration() * 1000 / g->get_width());
 }
 
-void Graph::draw(Display *buff, uint16_t x_offset, uint16_t y_offset, Color color) {
-  /// Plot border
-  if (this->border_) {
-    buff->horizontal_line(x_offset, y_offset, this->width_, color);
-    buff->horizontal_line(x_offset, y_offset + this->height_ - 1, this->width_, color);
-    buff->vertical_line(x_offset, y_offset, this->height_, color);
-    buff->vertical_line(x_offset + this->width_ - 1, y_offset, this->height_, color);
-  }
-  /// Determine best y-axis scale and range
+/// Determine best y-axis scale and range, returns true if it differs from the previous one
+bool Graph::update_scale_() {
   float ymin = NAN;
   float ymax = NAN;
   for (auto *trace : traces_) {
@@ -134,6 +153,59 @@ void Graph::draw(Display *buff, uint16_t x_offset, uint16_t y_offset, Color colo
     ymax = ym * y_per_div;
     yrange = ymax - ymin;
   }
+  ESP_LOGV(TAG, "Updating graph. ymin %f, ymax %f", ymin, ymax);
+
+  // NAN never compares equal, so a scale without data always counts as changed
+  bool changed = !(ymin == this->ymin_ && yrange == this->yrange_) || yn != this->yn_ || ym != this->ym_;
+  this->ymin_ = ymin;
+  this->yrange_ = yrange;
+  this->yn_ = yn;
+  this->ym_ = ym;
+  return changed;
+}
+
+/// Convert the columns of a trace to pixel rows, only the newly completed ones unless the scale changed
+void Graph::update_rows_(GraphTrace *trace, bool rescaled) {
+  const HistoryData *data = trace->get_tracedata();
+  uint32_t added = data->get_revision() - trace->rows_revision_;
+  uint32_t n = (rescaled || added > this->width_) ? this->width_ : added;
+  for (uint32_t i = 0; i < n; i++) {
+    float v = (data->get_value(i) - this->ymin_) / this->yrange_;
+    trace->rows_[data->get_slot(i)] =
+        std::isnan(v) ? NO_ROW : (int16_t) roundf((this->height_ - 1) * (1.0 - v)) - trace->get_line_thickness() / 2;
+  }
+  trace->rows_revision_ = data->get_revision();
+}
+
+/// Draw the rows [y_begin, y_end) of a column, clipped to the graph area
+void Graph::draw_span_(Display *buff, int16_t x, int16_t y_begin, int16_t y_end, int16_t y_offset, Color color) {
+  y_begin = std::max<int16_t>(y_begin, y_offset);
+  y_end = std::min<int16_t>(y_end, y_offset + this->height_);
+  if (y_end > y_begin)
+    buff->vertical_line(x, y_begin, y_end - y_begin, color);
+}
+
+void Graph::draw(Display *buff, uint16_t x_offset, uint16_t y_offset, Color color) {
+  /// Plot border
+  if (this->border_) {
+    buff->horizontal_line(x_offset, y_offset, this->width_, color);
+    buff->horizontal_line(x_offset, y_offset + this->height_ - 1, this->width_, color);
+    buff->vertical_line(x_offset, y_offset, this->height_, color);
+    buff->vertical_line(x_offset + this->width_ - 1, y_offset, this->height_, color);
+  }
+  /// The scale and the trace rows only change when a trace completes a column
+  uint32_t revision = 0;
+  for (auto *trace : traces_)
+    revision += trace->get_tracedata()->get_revision();
+  if (!this->scale_valid_ || revision != this->scale_revision_) {
+    bool rescaled = this->update_scale_();
+    for (auto *trace : traces_)
+      this->update_rows_(trace, rescaled);
+    this->scale_revision_ = revision;
+    this->scale_valid_ = true;
+  }
+  int yn = this->yn_;
+  int ym = this->ym_;
 
   /// Draw grid
   if (!std::isnan(this->gridspacing_y_)) {
@@ -161,42 +233,32 @@ void Graph::draw(Display *buff, uint16_t x_offset, uint16_t y_offset, Color colo
   }
 
   /// Draw traces
-  ESP_LOGV(TAG, "Updating graph. ymin %f, ymax %f", ymin, ymax);
   for (auto *trace : traces_) {
     Color c = trace->get_line_color();
     int16_t thick = trace->get_line_thickness();
     bool continuous = trace->get_continuous();
+    const HistoryData *data = trace->get_tracedata();
     bool has_prev = false;
     bool prev_b = false;
     int16_t prev_y = 0;
     for (uint32_t i = 0; i < this->width_; i++) {
-      float v = (trace->get_tracedata()->get_value(i) - ymin) / yrange;
-      if (!std::isnan(v) && (thick > 0)) {
+      int16_t row = trace->rows_[data->get_slot(i)];
+      if (row != NO_ROW && (thick > 0)) {
         int16_t x = this->width_ - 1 - i + x_offset;
         uint8_t bit = 1 << ((i % (thick * LineType::PATTERN_LENGTH)) / thick);
         bool b = (trace->get_line_type() & bit) == bit;
         if (b) {
-          int16_t y = (int16_t) roundf((this->height_ - 1) * (1.0 - v)) - thick / 2 + y_offset;
-          auto draw_pixel_at = [&buff, c, y_offset, this](int16_t x, int16_t y) {
-            if (y >= y_offset && y < y_offset + this->height_)
-              buff->draw_pixel_at(x, y, c);
-          };
+          int16_t y = row + y_offset;
           if (!continuous || !has_prev || !prev_b || (abs(y - prev_y) <= thick)) {
-            for (int16_t t = 0; t < thick; t++) {
-              draw_pixel_at(x, y + t);
-            }
+            this->draw_span_(buff, x, y, y + thick, y_offset, c);
           } else {
             int16_t mid_y = (y + prev_y + thick) / 2;
             if (y > prev_y) {
-              for (int16_t t = prev_y + thick; t <= mid_y; t++)
-                draw_pixel_at(x + 1, t);
-              for (int16_t t = mid_y + 1; t < y + thick; t++)
-                draw_pixel_at(x, t);
+              this->draw_span_(buff, x + 1, prev_y + thick, mid_y + 1, y_offset, c);
+              this->draw_span_(buff, x, mid_y + 1, y + thick, y_offset, c);
             } else {
-              for (int16_t t = prev_y - 1; t >= mid_y; t--)
-                draw_pixel_at(x + 1, t);
-              for (int16_t t = mid_y - 1; t >= y; t--)
-                draw_pixel_at(x, t);
+              this->draw_span_(buff, x + 1, mid_y, prev_y, y_offset, c);
+              this->draw_span_(buff, x, y, mid_y, y_offset, c);
             }
           }
           prev_y = y;
@@ -83,6 +83,17 @@ class GraphLegend {
   friend Graph;
 };
 
+/// Summary of all samples that fell into one column of the graph.
+struct HistoryBucket {
+  float min{NAN};
+  float max{NAN};
+  float sum{0};
+  uint16_t count{0};
+
+  void add(float value);
+  float average() const { return this->count == 0 ? NAN : this->sum / this->count; }
+};
+
 class HistoryData {
  public:
   void init(int length);
@@ -90,9 +101,15 @@ class HistoryData {
   void set_update_time_ms(uint32_t update_time_ms) { update_time_ = update_time_ms; }
   void take_sample(float data);
   int get_length() const { return length_; }
-  float get_value(int idx) const { return samples_[(count_ + length_ - 1 - idx) % length_]; }
+  /// Ring position of a column; idx 0 is the most recently completed column.
+  int get_slot(int idx) const { return (count_ + length_ - 1 - idx) % length_; }
+  float get_value(int idx) const { return buckets_[this->get_slot(idx)].average(); }
+  float get_min(int idx) const { return buckets_[this->get_slot(idx)].min; }
+  float get_max(int idx) const { return buckets_[this->get_slot(idx)].max; }
   float get_recent_max() const { return recent_max_; }
   float get_recent_min() const { return recent_min_; }
+  /// Incremented every time a column is completed.
+  uint32_t get_revision() const { return revision_; }
 
  protected:
   uint32_t last_sample_;
@@ -100,9 +117,12 @@ class HistoryData {
   uint32_t update_time_{0};  /// in ms
   int length_;
   int count_{0};
+  uint32_t revision_{0};
   float recent_min_{NAN};
   float recent_max_{NAN};
-  std::vector<float> samples_;
+  HistoryBucket current_;
+  bool sampled_{false};
+  std::vector<HistoryBucket> buckets_;
 };
 
 class GraphTrace {
@@ -129,6 +149,9 @@ class GraphTrace {
   Color line_color_{COLOR_ON};
   bool continuous_{false};
   HistoryData data_;
+  // Pixel row of every column at the current scale, indexed by ring slot
+  std::vector<int16_t> rows_;
+  uint32_t rows_revision_{0};
 
   friend Graph;
   friend GraphLegend;
@@ -163,6 +186,10 @@ class Graph : public Component {
   uint32_t get_height() { return height_; }
 
  protected:
+  bool update_scale_();
+  void update_rows_(GraphTrace *trace, bool rescaled);
+  void draw_span_(display::Display *buff, int16_t x, int16_t y_begin, int16_t y_end, int16_t y_offset, Color color);
+
   uint32_t duration_;  /// in seconds
   uint32_t width_;     /// in pixels
   uint32_t height_;    /// in pixels
@@ -175,6 +202,13 @@ class Graph : public Component {
   bool border_{true};
   std::vector<GraphTrace *> traces_;
   GraphLegend *legend_{nullptr};
+  // Scale computed from the trace data, reused until a trace completes a column
+  float ymin_{NAN};
+  float yrange_{NAN};
+  int yn_{0};
+  int ym_{1};
+  uint32_t scale_revision_{0};
+  bool scale_valid_{false};
 
   friend GraphLegend;
 };
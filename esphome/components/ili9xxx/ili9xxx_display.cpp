@@ -61,6 +61,7 @@ void ILI9XXXDisplay::setup() {
   this->y_low_ = this->height_;
   this->x_high_ = 0;
   this->y_high_ = 0;
+  this->init_dirty_tiles_();
 }
 
 void ILI9XXXDisplay::alloc_buffer_() {
@@ -129,37 +130,9 @@ void ILI9XXXDisplay::dump_config() {
 float ILI9XXXDisplay::get_setup_priority() const { return setup_priority::HARDWARE; }
 
 void ILI9XXXDisplay::fill(Color color) {
-  if (!this->check_buffer_())
-    return;
-  uint16_t new_color = 0;
-  this->x_low_ = 0;
-  this->y_low_ = 0;
-  this->x_high_ = this->get_width_internal() - 1;
-  this->y_high_ = this->get_height_internal() - 1;
-  switch (this->buffer_color_mode_) {
-    case BITS_8_INDEXED:
-      new_color = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
-      break;
-    case BITS_16:
-      new_color = display::ColorUtil::color_to_565(color);
-      {
-        const uint32_t buffer_length_16_bits = this->get_buffer_length_() * 2;
-        if (((uint8_t) (new_color >> 8)) == ((uint8_t) new_color)) {
-          // Upper and lower is equal can use quicker memset operation. Takes ~20ms.
-          memset(this->buffer_, (uint8_t) new_color, buffer_length_16_bits);
-        } else {
-          for (uint32_t i = 0; i < buffer_length_16_bits; i = i + 2) {
-            this->buffer_[i] = (uint8_t) (new_color >> 8);
-            this->buffer_[i + 1] = (uint8_t) new_color;
-          }
-        }
-      }
-      return;
-    default:
-      new_color = display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
-      break;
-  }
-  memset(this->buffer_, (uint8_t) new_color, this->get_buffer_length_());
+  // Only the parts of the buffer that don't hold the color yet are written and marked dirty, so clearing the display
+  // before every update doesn't retransmit the whole frame.
+  this->fill_absolute_rect_internal(0, 0, this->get_width_internal(), this->get_height_internal(), color);
 }
 
 void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color) {
@@ -204,6 +177,68 @@ void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color)
       this->x_high_ = x;
     if (y > this->y_high_)
       this->y_high_ = y;
+    this->mark_dirty_(x, y, 1, 1);
+  }
+}
+
+void HOT ILI9XXXDisplay::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  if (!this->check_buffer_())
+    return;
+  // Pixel bytes in buffer order, 8 bit modes use the same value for both.
+  uint8_t high, low;
+  size_t bytes_per_pixel = 1;
+  switch (this->buffer_color_mode_) {
+    case BITS_8_INDEXED:
+      high = low = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
+      break;
+    case BITS_16: {
+      uint16_t new_color = display::ColorUtil::color_to_565(color, display::ColorOrder::COLOR_ORDER_RGB);
+      high = new_color >> 8;
+      low = new_color;
+      bytes_per_pixel = 2;
+      break;
+    }
+    default:
+      high = low = display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
+      break;
+  }
+  const uint8_t pixel[2] = {high, low};
+  uint16_t word;
+  memcpy(&word, pixel, sizeof(word));
+
+  for (int row = y; row != y + height; row++) {
+    uint8_t *line = this->buffer_ + ((size_t) row * this->width_ + x) * bytes_per_pixel;
+    auto matches = [&](int i) {
+      return line[i * bytes_per_pixel] == high && line[i * bytes_per_pixel + bytes_per_pixel - 1] == low;
+    };
+    // Only touch the part of the row that actually changes so the watermarks stay tight.
+    int first = 0;
+    while (first != width && matches(first))
+      first++;
+    if (first == width)
+      continue;
+    int last = width - 1;
+    while (matches(last))
+      last--;
+
+    uint8_t *start = line + first * bytes_per_pixel;
+    size_t count = last - first + 1;
+    if (high == low) {
+      memset(start, low, count * bytes_per_pixel);
+    } else {
+      for (size_t i = 0; i != count; i++)
+        memcpy(start + i * 2, &word, sizeof(word));
+    }
+
+    if (x + first < this->x_low_)
+      this->x_low_ = x + first;
+    if (row < this->y_low_)
+      this->y_low_ = row;
+    if (x + last > this->x_high_)
+      this->x_high_ = x + last;
+    if (row > this->y_high_)
+      this->y_high_ = row;
+    this->mark_dirty_(x + first, row, last - first + 1, 1);
   }
 }
 
@@ -247,54 +282,13 @@ void ILI9XXXDisplay::display_() {
     ESP_LOGV(TAG, "Doing single write of %zu bytes", this->width_ * h * 2);
     set_addr_window_(0, this->y_low_, this->width_ - 1, this->y_high_);
     this->write_array(this->buffer_ + this->y_low_ * this->width_ * 2, h * this->width_ * 2);
+    this->end_data_();
+    this->clear_dirty_tiles_();
   } else {
-    ESP_LOGV(TAG, "Doing multiple write");
-    uint8_t transfer_buffer[ILI9XXX_TRANSFER_BUFFER_SIZE];
-    size_t rem = h * w;  // remaining number of pixels to write
-    set_addr_window_(this->x_low_, this->y_low_, this->x_high_, this->y_high_);
-    size_t idx = 0;    // index into transfer_buffer
-    size_t pixel = 0;  // pixel number offset
-    size_t pos = this->y_low_ * this->width_ + this->x_low_;
-    while (rem-- != 0) {
-      uint16_t color_val;
-      switch (this->buffer_color_mode_) {
-        case BITS_8:
-          color_val = display::ColorUtil::color_to_565(display::ColorUtil::rgb332_to_color(this->buffer_[pos++]));
-          break;
-        case BITS_8_INDEXED:
-          color_val = display::ColorUtil::color_to_565(
-              display::ColorUtil::index8_to_color_palette888(this->buffer_[pos++], this->palette_));
-          break;
-        default:  // case BITS_16:
-          color_val = (this->buffer_[pos * 2] << 8) + this->buffer_[pos * 2 + 1];
-          pos++;
-          break;
-      }
-      if (this->is_18bitdisplay_) {
-        transfer_buffer[idx++] = (uint8_t) ((color_val & 0xF800) >> 8);  // Blue
-        transfer_buffer[idx++] = (uint8_t) ((color_val & 0x7E0) >> 3);   // Green
-        transfer_buffer[idx++] = (uint8_t) (color_val << 3);             // Red
-      } else {
-        put16_be(transfer_buffer + idx, color_val);
-        idx += 2;
-      }
-      if (idx == sizeof(transfer_buffer)) {
-        this->write_array(transfer_buffer, idx);
-        idx = 0;
-        App.feed_wdt();
-      }
-      // end of line? Skip to the next.
-      if (++pixel == w) {
-        pixel = 0;
-        pos += this->width_ - w;
-      }
-    }
-    // flush any balance.
-    if (idx != 0) {
-      this->write_array(transfer_buffer, idx);
-    }
+    // only send the tiles that changed instead of the whole watermark box
+    size_t rects = this->flush_dirty_tiles_();
+    ESP_LOGV(TAG, "Doing multiple write of %zu rectangles", rects);
   }
-  this->end_data_();
   ESP_LOGV(TAG, "Data write took %dms", (unsigned) (millis() - now));
   // invalidate watermarks
   this->x_low_ = this->width_;
@@ -303,6 +297,55 @@ void ILI9XXXDisplay::display_() {
   this->y_high_ = 0;
 }
 
+void ILI9XXXDisplay::write_dirty_rect_(int x, int y, int width, int height) {
+  uint8_t transfer_buffer[ILI9XXX_TRANSFER_BUFFER_SIZE];
+  const size_t w = width;
+  size_t rem = w * height;  // remaining number of pixels to write
+  set_addr_window_(x, y, x + width - 1, y + height - 1);
+  size_t idx = 0;    // index into transfer_buffer
+  size_t pixel = 0;  // pixel number offset
+  size_t pos = y * this->width_ + x;
+  while (rem-- != 0) {
+    uint16_t color_val;
+    switch (this->buffer_color_mode_) {
+      case BITS_8:
+        color_val = display::ColorUtil::color_to_565(display::ColorUtil::rgb332_to_color(this->buffer_[pos++]));
+        break;
+      case BITS_8_INDEXED:
+        color_val = display::ColorUtil::color_to_565(
+            display::ColorUtil::index8_to_color_palette888(this->buffer_[pos++], this->palette_));
+        break;
+      default:  // case BITS_16:
+        color_val = (this->buffer_[pos * 2] << 8) + this->buffer_[pos * 2 + 1];
+        pos++;
+        break;
+    }
+    if (this->is_18bitdisplay_) {
+      transfer_buffer[idx++] = (uint8_t) ((color_val & 0xF800) >> 8);  // Blue
+      transfer_buffer[idx++] = (uint8_t) ((color_val & 0x7E0) >> 3);   // Green
+      transfer_buffer[idx++] = (uint8_t) (color_val << 3);             // Red
+    } else {
+      put16_be(transfer_buffer + idx, color_val);
+      idx += 2;
+    }
+    if (idx == sizeof(transfer_buffer)) {
+      this->write_array(transfer_buffer, idx);
+      idx = 0;
+      App.feed_wdt();
+    }
+    // end of line? Skip to the next.
+    if (++pixel == w) {
+      pixel = 0;
+      pos += this->width_ - w;
+    }
+  }
+  // flush any balance.
+  if (idx != 0) {
+    this->write_array(transfer_buffer, idx);
+  }
+  this->end_data_();
+}
+
 // note that this bypasses the buffer and writes directly to the display.
 void ILI9XXXDisplay::draw_pixels_at(int x_start, int y_start, int w, int h, const uint8_t *ptr,
                                     display::ColorOrder order, display::ColorBitness bitness, bool big_endian,
@@ -311,10 +354,12 @@ void ILI9XXXDisplay::draw_pixels_at(int x_start, int y_start, int w, int h, cons
     return;
   // if color mapping or software rotation is required, hand this off to the parent implementation. This will
   // do color conversion pixel-by-pixel into the buffer and draw it later. If this is happening the user has not
-  // configured the renderer well.
-  if (this->rotation_ != display::DISPLAY_ROTATION_0_DEGREES || bitness != display::COLOR_BITNESS_565 || !big_endian) {
-    return display::Display::draw_pixels_at(x_start, y_start, w, h, ptr, order, bitness, big_endian, x_offset, y_offset,
-                                            x_pad);
+  // configured the renderer well. The same applies once a buffer exists, as it would overwrite the direct write
+  // on the next update.
+  if (this->rotation_ != display::DISPLAY_ROTATION_0_DEGREES || bitness != display::COLOR_BITNESS_565 || !big_endian ||
+      this->buffer_ != nullptr) {
+    return display::DisplayBuffer::draw_pixels_at(x_start, y_start, w, h, ptr, order, bitness, big_endian, x_offset,
+                                                  y_offset, x_pad);
   }
   this->set_addr_window_(x_start, y_start, x_start + w - 1, y_start + h - 1);
   // x_ and y_offset are offsets into the source buffer, unrelated to our own offsets into the display.
@@ -46,6 +46,11 @@ IMAGE_TYPE = {
 }
 
 CONF_USE_TRANSPARENCY = "use_transparency"
+CONF_COMPRESS = "compress"
+
+# Control byte of a compressed run, the low 7 bits hold the pixel count minus one.
+RLE_REPEAT = 0x80
+RLE_MAX_RUN = 128
 
 # If the MDI file cannot be downloaded within this time, abort.
 IMAGE_DOWNLOAD_TIMEOUT = 30  # seconds
@@ -227,6 +232,9 @@ IMAGE_SCHEMA = cv.Schema(
             cv.Optional(CONF_DITHER, default="NONE"): cv.one_of(
                 "NONE", "FLOYDSTEINBERG", upper=True
             ),
+            # Not setting default here on purpose; images are compressed when it saves space,
+            # unless LVGL is used, which decodes compressed images into RAM as a whole.
+            cv.Optional(CONF_COMPRESS): cv.boolean,
             cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
         },
         validate_cross_dependencies,
@@ -236,6 +244,46 @@ IMAGE_SCHEMA = cv.Schema(
 CONFIG_SCHEMA = cv.All(font.validate_pillow_installed, IMAGE_SCHEMA)
 
 
+def rle_encode_row(row, bytes_per_pixel):
+    """Encode one image row as runs of repeated pixels and literal pixels."""
+    pixels = [
+        tuple(row[i : i + bytes_per_pixel]) for i in range(0, len(row), bytes_per_pixel)
+    ]
+    data = []
+    x = 0
+    while x < len(pixels):
+        end = x + 1
+        while end < len(pixels) and pixels[end] == pixels[x] and end - x < RLE_MAX_RUN:
+            end += 1
+        if end - x > 1:
+            data.append(RLE_REPEAT | (end - x - 1))
+            data += pixels[x]
+        else:
+            # Extend the literal until the next pair of equal pixels starts a repeat.
+            while (
+                end < len(pixels)
+                and end - x < RLE_MAX_RUN
+                and (end + 1 == len(pixels) or pixels[end] != pixels[end + 1])
+            ):
+                end += 1
+            data.append(end - x - 1)
+            for pixel in pixels[x:end]:
+                data += pixel
+        x = end
+    return data
+
+
+def rle_encode_image(data, width, height, bytes_per_pixel):
+    """Prefix the encoded rows with a table of little endian row offsets."""
+    stride = width * bytes_per_pixel
+    offsets = []
+    rows = []
+    for y in range(height):
+        offsets += list(len(rows).to_bytes(4, "little"))
+        rows += rle_encode_row(data[y * stride : (y + 1) * stride], bytes_per_pixel)
+    return offsets + rows
+
+
 def load_svg_image(file: bytes, resize: tuple[int, int]):
     # Local imports only to allow "validate_pillow_installed" to run *before* importing it
     # cairosvg is only needed in case of SVG images; adding it
@@ -400,9 +448,33 @@ async def to_code(config):
             f"Image f{config[CONF_ID]} has an unsupported type: {config[CONF_TYPE]}."
         )
 
+    compressed = False
+    compress = config.get(CONF_COMPRESS, "lvgl" not in CORE.loaded_integrations)
+    if compress and config[CONF_TYPE] not in [
+        "BINARY",
+        "TRANSPARENT_BINARY",
+    ]:
+        encoded = rle_encode_image(data, width, height, len(data) // (width * height))
+        if len(encoded) < len(data):
+            _LOGGER.debug(
+                "%s compressed from %d to %d bytes",
+                config[CONF_ID],
+                len(data),
+                len(encoded),
+            )
+            data = encoded
+            compressed = True
+        elif CONF_COMPRESS in config:
+            _LOGGER.info(
+                "%s does not get smaller when compressed, storing it uncompressed",
+                config[CONF_ID],
+            )
+
     rhs = [HexInt(x) for x in data]
     prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
     var = cg.new_Pvariable(
         config[CONF_ID], prog_arr, width, height, IMAGE_TYPE[config[CONF_TYPE]]
     )
     cg.add(var.set_transparency(transparent))
+    if compressed:
+        cg.add(var.set_compressed(True))
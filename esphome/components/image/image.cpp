@@ -5,60 +5,66 @@
 namespace esphome {
 namespace image {
 
+/// Number of pixels converted per draw_pixels_at() call when blitting colored images.
+static const int BLIT_CHUNK_PIXELS = 64;
+
 void Image::draw(int x, int y, display::Display *display, Color color_on, Color color_off) {
-  switch (type_) {
-    case IMAGE_TYPE_BINARY: {
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          if (this->get_binary_pixel_(img_x, img_y)) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_on);
-          } else if (!this->transparent_) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_off);
-          }
+  if (this->type_ == IMAGE_TYPE_BINARY) {
+    // Draw runs of equal pixels as spans so buffered displays can fill them a row at a time.
+    for (int img_y = 0; img_y < this->height_; img_y++) {
+      int img_x = 0;
+      while (img_x < this->width_) {
+        const bool on = this->get_binary_pixel_(img_x, img_y);
+        int run_end = img_x + 1;
+        while (run_end < this->width_ && this->get_binary_pixel_(run_end, img_y) == on)
+          run_end++;
+        if (on) {
+          display->horizontal_line(x + img_x, y + img_y, run_end - img_x, color_on);
+        } else if (!this->transparent_) {
+          display->horizontal_line(x + img_x, y + img_y, run_end - img_x, color_off);
         }
+        img_x = run_end;
       }
-      break;
     }
-    case IMAGE_TYPE_GRAYSCALE:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_grayscale_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
-      }
-      break;
-    case IMAGE_TYPE_RGB565:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb565_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
+    return;
+  }
+
+  if (display->get_display_type() != display::DISPLAY_TYPE_COLOR) {
+    // Binary and grayscale displays look at the white channel, which the packed pixel formats can't carry.
+    for (int img_y = 0; img_y < this->height_; img_y++) {
+      for (int img_x = 0; img_x < this->width_; img_x++) {
+        auto color = this->get_pixel(img_x, img_y);
+        if (color.w >= 0x80)
+          display->draw_pixel_at(x + img_x, y + img_y, color);
       }
-      break;
-    case IMAGE_TYPE_RGB24:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb24_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
+    }
+    return;
+  }
+
+  // Convert each row into runs of opaque RGB888 pixels and hand them to the display in one call each.
+  uint8_t row[BLIT_CHUNK_PIXELS * 3];
+  for (int img_y = 0; img_y < this->height_; img_y++) {
+    int run_start = 0;
+    int run_length = 0;
+    auto flush = [&]() {
+      if (run_length != 0) {
+        display->draw_pixels_at(x + run_start, y + img_y, run_length, 1, row, display::COLOR_ORDER_RGB,
+                                display::COLOR_BITNESS_888, true);
+        run_length = 0;
       }
-      break;
-    case IMAGE_TYPE_RGBA:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgba_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
+    };
+    for (int img_x = 0; img_x < this->width_; img_x++) {
+      uint8_t *pixel = row + run_length * 3;
+      if (!this->decode_rgb_pixel_(img_x, img_y, pixel)) {
+        flush();
+        continue;
       }
-      break;
+      if (run_length == 0)
+        run_start = img_x;
+      if (++run_length == BLIT_CHUNK_PIXELS)
+        flush();
+    }
+    flush();
   }
 }
 Color Image::get_pixel(int x, int y, Color color_on, Color color_off) const {
@@ -81,9 +87,19 @@ Color Image::get_pixel(int x, int y, Color color_on, Color color_off) const {
 }
 #ifdef USE_LVGL
 lv_img_dsc_t *Image::get_lv_img_dsc() {
+  const uint8_t *data = this->data_start_;
+  if (this->compressed_) {
+    // LVGL needs the plain pixels, decode the whole image into RAM once.
+    if (this->decoded_image_.empty()) {
+      this->decoded_image_.resize(this->get_width_stride() * this->height_);
+      for (int y = 0; y != this->height_; y++)
+        this->decode_row_(y, this->decoded_image_.data() + y * this->get_width_stride());
+    }
+    data = this->decoded_image_.data();
+  }
   // lazily construct lvgl image_dsc.
-  if (this->dsc_.data != this->data_start_) {
-    this->dsc_.data = this->data_start_;
+  if (this->dsc_.data != data) {
+    this->dsc_.data = data;
     this->dsc_.header.always_zero = 0;
     this->dsc_.header.reserved = 0;
     this->dsc_.header.w = this->width_;
@@ -123,20 +139,58 @@ lv_img_dsc_t *Image::get_lv_img_dsc() {
 }
 #endif  // USE_LVGL
 
+bool HOT Image::decode_rgb_pixel_(int x, int y, uint8_t *rgb) const {
+  const uint8_t *ptr = this->get_pixel_ptr_(x, y);
+  switch (this->type_) {
+    case IMAGE_TYPE_GRAYSCALE: {
+      const uint8_t gray = progmem_read_byte(ptr);
+      rgb[0] = rgb[1] = rgb[2] = gray;
+      return gray != 1 || !this->transparent_;
+    }
+    case IMAGE_TYPE_RGB565: {
+      if (this->transparent_ && progmem_read_byte(ptr + 2) < 0x80)
+        return false;
+      const uint16_t rgb565 = encode_uint16(progmem_read_byte(ptr), progmem_read_byte(ptr + 1));
+      const uint8_t r = (rgb565 & 0xF800) >> 11;
+      const uint8_t g = (rgb565 & 0x07E0) >> 5;
+      const uint8_t b = rgb565 & 0x001F;
+      rgb[0] = (r << 3) | (r >> 2);
+      rgb[1] = (g << 2) | (g >> 4);
+      rgb[2] = (b << 3) | (b >> 2);
+      return true;
+    }
+    case IMAGE_TYPE_RGB24: {
+      rgb[0] = progmem_read_byte(ptr + 0);
+      rgb[1] = progmem_read_byte(ptr + 1);
+      rgb[2] = progmem_read_byte(ptr + 2);
+      // (0, 0, 1) is the transparent color for images without alpha channel
+      return !(rgb[2] == 1 && rgb[0] == 0 && rgb[1] == 0 && this->transparent_);
+    }
+    case IMAGE_TYPE_RGBA: {
+      if (progmem_read_byte(ptr + 3) < 0x80)
+        return false;
+      rgb[0] = progmem_read_byte(ptr + 0);
+      rgb[1] = progmem_read_byte(ptr + 1);
+      rgb[2] = progmem_read_byte(ptr + 2);
+      return true;
+    }
+    default:
+      return false;
+  }
+}
 bool Image::get_binary_pixel_(int x, int y) const {
   const uint32_t width_8 = ((this->width_ + 7u) / 8u) * 8u;
   const uint32_t pos = x + y * width_8;
   return progmem_read_byte(this->data_start_ + (pos / 8u)) & (0x80 >> (pos % 8u));
 }
 Color Image::get_rgba_pixel_(int x, int y) const {
-  const uint32_t pos = (x + y * this->width_) * 4;
-  return Color(progmem_read_byte(this->data_start_ + pos + 0), progmem_read_byte(this->data_start_ + pos + 1),
-               progmem_read_byte(this->data_start_ + pos + 2), progmem_read_byte(this->data_start_ + pos + 3));
+  const uint8_t *pos = this->get_pixel_ptr_(x, y);
+  return Color(progmem_read_byte(pos + 0), progmem_read_byte(pos + 1), progmem_read_byte(pos + 2),
+               progmem_read_byte(pos + 3));
 }
 Color Image::get_rgb24_pixel_(int x, int y) const {
-  const uint32_t pos = (x + y * this->width_) * 3;
-  Color color = Color(progmem_read_byte(this->data_start_ + pos + 0), progmem_read_byte(this->data_start_ + pos + 1),
-                      progmem_read_byte(this->data_start_ + pos + 2));
+  const uint8_t *pos = this->get_pixel_ptr_(x, y);
+  Color color = Color(progmem_read_byte(pos + 0), progmem_read_byte(pos + 1), progmem_read_byte(pos + 2));
   if (color.b == 1 && color.r == 0 && color.g == 0 && transparent_) {
     // (0, 0, 1) has been defined as transparent color for non-alpha images.
     // putting blue == 1 as a first condition for performance reasons (least likely value to short-cut the if)
@@ -147,12 +201,7 @@ Color Image::get_rgb24_pixel_(int x, int y) const {
   return color;
 }
 Color Image::get_rgb565_pixel_(int x, int y) const {
-  const uint8_t *pos = this->data_start_;
-  if (this->transparent_) {
-    pos += (x + y * this->width_) * 3;
-  } else {
-    pos += (x + y * this->width_) * 2;
-  }
+  const uint8_t *pos = this->get_pixel_ptr_(x, y);
   uint16_t rgb565 = encode_uint16(progmem_read_byte(pos), progmem_read_byte(pos + 1));
   auto r = (rgb565 & 0xF800) >> 11;
   auto g = (rgb565 & 0x07E0) >> 5;
@@ -163,11 +212,45 @@ Color Image::get_rgb565_pixel_(int x, int y) const {
 }
 
 Color Image::get_grayscale_pixel_(int x, int y) const {
-  const uint32_t pos = (x + y * this->width_);
-  const uint8_t gray = progmem_read_byte(this->data_start_ + pos);
+  const uint8_t gray = progmem_read_byte(this->get_pixel_ptr_(x, y));
   uint8_t alpha = (gray == 1 && transparent_) ? 0 : 0xFF;
   return Color(gray, gray, gray, alpha);
 }
+const uint8_t *Image::get_pixel_ptr_(int x, int y) const {
+  const uint32_t pixel_size = this->get_bpp() / 8;
+  if (!this->compressed_)
+    return this->data_start_ + (x + y * this->width_) * pixel_size;
+  if (y != this->decoded_row_index_) {
+    this->decoded_row_.resize(this->get_width_stride());
+    this->decode_row_(y, this->decoded_row_.data());
+    this->decoded_row_index_ = y;
+  }
+  return this->decoded_row_.data() + x * pixel_size;
+}
+void HOT Image::decode_row_(int y, uint8_t *row) const {
+  // A table of little endian 32 bit row offsets precedes the encoded rows.
+  const uint8_t *entry = this->data_start_ + y * 4;
+  const uint32_t offset = encode_uint32(progmem_read_byte(entry + 3), progmem_read_byte(entry + 2),
+                                        progmem_read_byte(entry + 1), progmem_read_byte(entry));
+  const uint8_t *src = this->data_start_ + this->height_ * 4 + offset;
+  const size_t pixel_size = this->get_bpp() / 8;
+  const uint8_t *end = row + this->width_ * pixel_size;
+  while (row < end) {
+    const uint8_t control = progmem_read_byte(src++);
+    const size_t count = (control & 0x7F) + 1;
+    if (control & 0x80) {
+      // one pixel repeated count times
+      for (size_t i = 0; i != pixel_size; i++)
+        row[i] = progmem_read_byte(src++);
+      for (size_t i = pixel_size; i != count * pixel_size; i++)
+        row[i] = row[i - pixel_size];
+    } else {
+      for (size_t i = 0; i != count * pixel_size; i++)
+        row[i] = progmem_read_byte(src++);
+    }
+    row += count * pixel_size;
+  }
+}
 int Image::get_width() const { return this->width_; }
 int Image::get_height() const { return this->height_; }
 ImageType Image::get_type() const { return this->type_; }
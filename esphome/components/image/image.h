@@ -1,4 +1,5 @@
 #pragma once
+#include <vector>
 #include "esphome/core/color.h"
 #include "esphome/components/display/display.h"
 
@@ -50,11 +51,22 @@ class Image : public display::BaseImage {
   void set_transparency(bool transparent) { transparent_ = transparent; }
   bool has_transparency() const { return transparent_; }
 
+  /// Pixel rows are run-length encoded behind a row offset table instead of stored plainly, set by code generation.
+  /// get_data_start() then points at the encoded data.
+  void set_compressed(bool compressed) { compressed_ = compressed; }
+  bool is_compressed() const { return compressed_; }
+
 #ifdef USE_LVGL
   lv_img_dsc_t *get_lv_img_dsc();
 #endif
  protected:
   bool get_binary_pixel_(int x, int y) const;
+  /// Write the RGB888 value of a non-binary pixel to rgb, returns false if the pixel is transparent.
+  bool decode_rgb_pixel_(int x, int y, uint8_t *rgb) const;
+  /// Return a pointer to the stored bytes of a non-binary pixel, decoding its row first for compressed images.
+  const uint8_t *get_pixel_ptr_(int x, int y) const;
+  /// Decode one row of a compressed image into row, which must hold get_width_stride() bytes.
+  void decode_row_(int y, uint8_t *row) const;
   Color get_rgb24_pixel_(int x, int y) const;
   Color get_rgba_pixel_(int x, int y) const;
   Color get_rgb565_pixel_(int x, int y) const;
@@ -65,7 +77,12 @@ class Image : public display::BaseImage {
   ImageType type_;
   const uint8_t *data_start_;
   bool transparent_;
+  bool compressed_{false};
+  // Last row decoded for pixel access to compressed images.
+  mutable std::vector<uint8_t> decoded_row_;
+  mutable int decoded_row_index_{-1};
 #ifdef USE_LVGL
+  std::vector<uint8_t> decoded_image_;
   lv_img_dsc_t dsc_{};
 #endif
 };
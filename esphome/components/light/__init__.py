@@ -60,6 +60,8 @@ from .types import (  # noqa
 CODEOWNERS = ["@esphome/core"]
 IS_PLATFORM_COMPONENT = True
 
+CONF_EFFECT_FRAME_RATE = "effect_frame_rate"
+
 LightRestoreMode = light_ns.enum("LightRestoreMode")
 RESTORE_MODES = {
     "RESTORE_DEFAULT_OFF": LightRestoreMode.LIGHT_RESTORE_DEFAULT_OFF,
@@ -120,6 +122,9 @@ BRIGHTNESS_ONLY_LIGHT_SCHEMA = LIGHT_SCHEMA.extend(
             CONF_FLASH_TRANSITION_LENGTH, default="0s"
         ): cv.positive_time_period_milliseconds,
         cv.Optional(CONF_EFFECTS): validate_effects(MONOCHROMATIC_EFFECTS),
+        cv.Optional(CONF_EFFECT_FRAME_RATE): cv.All(
+            cv.frequency, cv.Range(min=0, min_included=False)
+        ),
     }
 )
 
@@ -186,6 +191,8 @@ async def setup_light_core_(light_var, output_var, config):
         cg.add(light_var.set_flash_transition_length(flash_transition_length))
     if (gamma_correct := config.get(CONF_GAMMA_CORRECT)) is not None:
         cg.add(light_var.set_gamma_correct(gamma_correct))
+    if (effect_frame_rate := config.get(CONF_EFFECT_FRAME_RATE)) is not None:
+        cg.add(light_var.set_effect_frame_rate(effect_frame_rate))
     effects = await cg.build_registry_list(
         EFFECTS_REGISTRY, config.get(CONF_EFFECTS, [])
     )
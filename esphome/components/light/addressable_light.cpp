@@ -48,6 +48,120 @@ void AddressableLight::update_state(LightState *state) {
   this->schedule_show();
 }
 
+const uint8_t *AddressableLight::get_correction_tables_() {
+  const Color &max = this->correction_.get_max_brightness();
+  uint8_t local = this->correction_.get_local_brightness();
+  if (!this->correction_tables_) {
+    this->correction_tables_.reset(new uint8_t[4 * 256]);  // NOLINT
+  } else if (this->correction_tables_valid_ && this->correction_tables_max_ == max &&
+             this->correction_tables_local_ == local) {
+    return this->correction_tables_.get();
+  }
+  this->correction_.calculate_correction_tables(this->correction_tables_.get());
+  this->correction_tables_max_ = max;
+  this->correction_tables_local_ = local;
+  this->correction_tables_valid_ = true;
+  return this->correction_tables_.get();
+}
+
+template<PixelFormat F> static inline void read_pixel(const uint8_t *&data, uint8_t *rgbw) {
+  switch (F) {
+    case PIXEL_FORMAT_MONO:
+      rgbw[0] = rgbw[1] = rgbw[2] = rgbw[3] = data[0];
+      data += 1;
+      break;
+    case PIXEL_FORMAT_RGB:
+    case PIXEL_FORMAT_RGB_WHITE_AVERAGE:
+    case PIXEL_FORMAT_RGB_WHITE_MIN:
+    case PIXEL_FORMAT_RGB_KEEP_WHITE:
+      rgbw[0] = data[0];
+      rgbw[1] = data[1];
+      rgbw[2] = data[2];
+      if (F == PIXEL_FORMAT_RGB || F == PIXEL_FORMAT_RGB_KEEP_WHITE) {
+        rgbw[3] = 0;
+      } else if (F == PIXEL_FORMAT_RGB_WHITE_AVERAGE) {
+        rgbw[3] = (data[0] + data[1] + data[2]) / 3;
+      } else {
+        rgbw[3] = std::min(std::min(data[0], data[1]), data[2]);
+      }
+      data += 3;
+      break;
+    case PIXEL_FORMAT_RGBW:
+      rgbw[0] = data[0];
+      rgbw[1] = data[1];
+      rgbw[2] = data[2];
+      rgbw[3] = data[3];
+      data += 4;
+      break;
+  }
+}
+
+template<PixelFormat F> void AddressableLight::write_pixels_(int32_t start, int32_t count, const uint8_t *data) {
+  const uint8_t *tables = this->get_correction_tables_();
+  const uint8_t *red = tables;
+  const uint8_t *green = tables + 256;
+  const uint8_t *blue = tables + 512;
+  const uint8_t *white = tables + 768;
+  uint8_t rgbw[4];
+
+  if (count > 1 && this->has_flat_buffer_()) {
+    // Every pixel is the first one shifted by a constant stride
+    ESPColorView first = this->get_view_internal(start);
+    ptrdiff_t stride = this->get_view_internal(start + 1).red_ - first.red_;
+    uint8_t *r = first.red_, *g = first.green_, *b = first.blue_, *w = first.white_;
+    for (int32_t i = 0; i < count; i++, r += stride, g += stride, b += stride) {
+      read_pixel<F>(data, rgbw);
+      *r = red[rgbw[0]];
+      *g = green[rgbw[1]];
+      *b = blue[rgbw[2]];
+      if (F != PIXEL_FORMAT_RGB_KEEP_WHITE && w != nullptr) {
+        *w = white[rgbw[3]];
+        w += stride;
+      }
+    }
+    return;
+  }
+
+  for (int32_t i = 0; i < count; i++) {
+    ESPColorView view = this->get_view_internal(start + i);
+    read_pixel<F>(data, rgbw);
+    *view.red_ = red[rgbw[0]];
+    *view.green_ = green[rgbw[1]];
+    *view.blue_ = blue[rgbw[2]];
+    if (F != PIXEL_FORMAT_RGB_KEEP_WHITE && view.white_ != nullptr)
+      *view.white_ = white[rgbw[3]];
+  }
+}
+
+void AddressableLight::write_pixels(int32_t start, int32_t count, const uint8_t *data, PixelFormat format) {
+  if (start < 0 || start >= this->size())
+    return;
+  count = std::min(count, this->size() - start);
+  if (count <= 0)
+    return;
+
+  switch (format) {
+    case PIXEL_FORMAT_MONO:
+      this->write_pixels_<PIXEL_FORMAT_MONO>(start, count, data);
+      break;
+    case PIXEL_FORMAT_RGB:
+      this->write_pixels_<PIXEL_FORMAT_RGB>(start, count, data);
+      break;
+    case PIXEL_FORMAT_RGB_WHITE_AVERAGE:
+      this->write_pixels_<PIXEL_FORMAT_RGB_WHITE_AVERAGE>(start, count, data);
+      break;
+    case PIXEL_FORMAT_RGB_WHITE_MIN:
+      this->write_pixels_<PIXEL_FORMAT_RGB_WHITE_MIN>(start, count, data);
+      break;
+    case PIXEL_FORMAT_RGBW:
+      this->write_pixels_<PIXEL_FORMAT_RGBW>(start, count, data);
+      break;
+    case PIXEL_FORMAT_RGB_KEEP_WHITE:
+      this->write_pixels_<PIXEL_FORMAT_RGB_KEEP_WHITE>(start, count, data);
+      break;
+  }
+}
+
 void AddressableLightTransformer::start() {
   // don't try to transition over running effects.
   if (this->light_.is_effect_active())
@@ -62,13 +176,15 @@ void AddressableLightTransformer::start() {
 }
 
 optional<LightColorValues> AddressableLightTransformer::apply() {
-  float smoothed_progress = LightTransitionTransformer::smoothed_progress(this->get_progress_());
+  uint32_t smoothed_progress = LightTransitionTransformer::smoothed_progress_q16(this->get_progress_q16_());
 
   // When running an output-buffer modifying effect, don't try to transition individual LEDs, but instead just fade the
   // LightColorValues. write_state() then picks up the change in brightness, and the color change is picked up by the
   // effects which respect it.
-  if (this->light_.is_effect_active())
-    return LightColorValues::lerp(this->get_start_values(), this->get_target_values(), smoothed_progress);
+  if (this->light_.is_effect_active()) {
+    return LightColorValues::lerp(this->get_start_values(), this->get_target_values(),
+                                  smoothed_progress / float(Q16_ONE));
+  }
 
   // Use a specialized transition for addressable lights: instead of using a unified transition for
   // all LEDs, we use the current state of each LED as the start.
@@ -77,36 +193,79 @@ optional<LightColorValues> AddressableLightTransformer::apply() {
   // state of each LED at the start of the transition.
   // Instead, we "fake" the look of the LERP by using an exponential average over time and using
   // dynamically-calculated alpha values to match the look.
+  // All of this is done in Q16 fixed point, so it is cheap on chips without an FPU.
 
-  float denom = (1.0f - smoothed_progress);
-  float alpha = denom == 0.0f ? 1.0f : (smoothed_progress - this->last_transition_progress_) / denom;
+  uint32_t denom = Q16_ONE - smoothed_progress;
+  uint32_t delta =
+      smoothed_progress > this->last_transition_progress_ ? smoothed_progress - this->last_transition_progress_ : 0;
+  uint64_t alpha255 = denom == 0 ? uint64_t(255) << 16 : (uint64_t(delta) * (255 << 16)) / denom;
 
   // We need to use a low-resolution alpha here which makes the transition set in only after ~half of the length
   // We solve this by accumulating the fractional part of the alpha over time.
-  float alpha255 = alpha * 255.0f;
-  float alpha255int = floorf(alpha255);
-  float alpha255remainder = alpha255 - alpha255int;
+  this->accumulated_alpha_ += alpha255 & 0xFFFF;
+  alpha255 = (alpha255 >> 16) + (this->accumulated_alpha_ >> 16);
+  this->accumulated_alpha_ &= 0xFFFF;
+  auto alpha8 = static_cast<uint8_t>(std::min<uint64_t>(alpha255, 255));
 
-  this->accumulated_alpha_ += alpha255remainder;
-  float alpha_add = floorf(this->accumulated_alpha_);
-  this->accumulated_alpha_ -= alpha_add;
+  if (alpha8 != 0)
+    this->blend_(this->target_color_ * alpha8, 255 - alpha8);
 
-  alpha255 += alpha_add;
-  alpha255 = clamp(alpha255, 0.0f, 255.0f);
-  auto alpha8 = static_cast<uint8_t>(alpha255);
+  this->last_transition_progress_ = smoothed_progress;
+  this->light_.schedule_show();
 
-  if (alpha8 != 0) {
-    uint8_t inv_alpha8 = 255 - alpha8;
-    Color add = this->target_color_ * alpha8;
+  return {};
+}
 
-    for (auto led : this->light_)
-      led.set(add + led.get() * inv_alpha8);
+const uint8_t *AddressableLightTransformer::get_uncorrection_tables_() {
+  const Color &max = this->light_.correction_.get_max_brightness();
+  uint8_t local = this->light_.correction_.get_local_brightness();
+  if (!this->uncorrection_tables_) {
+    this->uncorrection_tables_.reset(new uint8_t[4 * 256]);  // NOLINT
+  } else if (this->uncorrection_tables_max_ == max && this->uncorrection_tables_local_ == local) {
+    return this->uncorrection_tables_.get();
   }
+  this->light_.correction_.calculate_uncorrection_tables(this->uncorrection_tables_.get());
+  this->uncorrection_tables_max_ = max;
+  this->uncorrection_tables_local_ = local;
+  return this->uncorrection_tables_.get();
+}
 
-  this->last_transition_progress_ = smoothed_progress;
-  this->light_.schedule_show();
+static inline void blend_channel(uint8_t *raw, uint8_t add, uint8_t keep, const uint8_t *uncorrect,
+                                 const uint8_t *correct) {
+  uint16_t value = add + esp_scale8(uncorrect[*raw], keep);
+  *raw = correct[value > 255 ? 255 : value];
+}
 
-  return {};
+void AddressableLightTransformer::blend_(const Color &add, uint8_t keep) {
+  const uint8_t *correct = this->light_.get_correction_tables_();
+  const uint8_t *uncorrect = this->get_uncorrection_tables_();
+  int32_t size = this->light_.size();
+
+  if (size > 1 && this->light_.has_flat_buffer_()) {
+    // Every pixel is the first one shifted by a constant stride
+    ESPColorView first = this->light_.get_view_internal(0);
+    ptrdiff_t stride = this->light_.get_view_internal(1).red_ - first.red_;
+    uint8_t *r = first.red_, *g = first.green_, *b = first.blue_, *w = first.white_;
+    for (int32_t i = 0; i < size; i++, r += stride, g += stride, b += stride) {
+      blend_channel(r, add.red, keep, uncorrect, correct);
+      blend_channel(g, add.green, keep, uncorrect + 256, correct + 256);
+      blend_channel(b, add.blue, keep, uncorrect + 512, correct + 512);
+      if (w != nullptr) {
+        blend_channel(w, add.white, keep, uncorrect + 768, correct + 768);
+        w += stride;
+      }
+    }
+    return;
+  }
+
+  for (int32_t i = 0; i < size; i++) {
+    ESPColorView view = this->light_.get_view_internal(i);
+    blend_channel(view.red_, add.red, keep, uncorrect, correct);
+    blend_channel(view.green_, add.green, keep, uncorrect + 256, correct + 256);
+    blend_channel(view.blue_, add.blue, keep, uncorrect + 512, correct + 512);
+    if (view.white_ != nullptr)
+      blend_channel(view.white_, add.white, keep, uncorrect + 768, correct + 768);
+  }
 }
 
 }  // namespace light
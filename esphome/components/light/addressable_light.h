@@ -3,6 +3,7 @@
 #include "esphome/core/component.h"
 #include "esphome/core/defines.h"
 #include "esphome/core/color.h"
+#include <memory>
 #include "esp_color_correction.h"
 #include "esp_color_view.h"
 #include "esp_range_view.h"
@@ -19,6 +20,16 @@ namespace light {
 
 using ESPColor ESPDEPRECATED("esphome::light::ESPColor is deprecated, use esphome::Color instead.", "v1.21") = Color;
 
+/// Channel layout of the data passed to AddressableLight::write_pixels().
+enum PixelFormat : uint8_t {
+  PIXEL_FORMAT_MONO,               ///< 1 byte per pixel, used for all channels
+  PIXEL_FORMAT_RGB,                ///< 3 bytes per pixel, white off
+  PIXEL_FORMAT_RGB_WHITE_AVERAGE,  ///< 3 bytes per pixel, white is the average of red, green and blue
+  PIXEL_FORMAT_RGB_WHITE_MIN,      ///< 3 bytes per pixel, white is the smallest of red, green and blue
+  PIXEL_FORMAT_RGBW,               ///< 4 bytes per pixel
+  PIXEL_FORMAT_RGB_KEEP_WHITE,     ///< 3 bytes per pixel, white left unchanged
+};
+
 /// Convert the color information from a `LightColorValues` object to a `Color` object (does not apply brightness).
 Color color_from_light_color_values(LightColorValues val);
 
@@ -70,8 +81,12 @@ class AddressableLight : public LightOutput, public Component {
   }
   void setup_state(LightState *state) override {
     this->correction_.calculate_gamma_table(state->get_gamma_correct());
+    this->correction_tables_valid_ = false;
     this->state_parent_ = state;
   }
+  /// Write `count` pixels starting at `start` from packed channel `data`, with the same color correction as
+  /// ESPColorView but through lookup tables, straight into the driver buffer when it has a flat layout.
+  void write_pixels(int32_t start, int32_t count, const uint8_t *data, PixelFormat format);
   void update_state(LightState *state) override;
   void schedule_show() { this->state_parent_->next_write_ = true; }
 
@@ -83,6 +98,7 @@ class AddressableLight : public LightOutput, public Component {
 
  protected:
   friend class AddressableLightTransformer;
+  friend class AddressableLightSegment;
 
   void mark_shown_() {
 #ifdef USE_POWER_SUPPLY
@@ -96,9 +112,18 @@ class AddressableLight : public LightOutput, public Component {
 #endif
   }
   virtual ESPColorView get_view_internal(int32_t index) const = 0;
+  /// Whether all pixels live in one driver buffer at a fixed stride, so write_pixels() can skip the views.
+  virtual bool has_flat_buffer_() const { return false; }
+  const uint8_t *get_correction_tables_();
+  template<PixelFormat F> void write_pixels_(int32_t start, int32_t count, const uint8_t *data);
 
   bool effect_active_{false};
   ESPColorCorrection correction_{};
+  // Color correction lookup tables for write_pixels(), built on first use
+  std::unique_ptr<uint8_t[]> correction_tables_;
+  Color correction_tables_max_{};
+  uint8_t correction_tables_local_{0};
+  bool correction_tables_valid_{false};
 #ifdef USE_POWER_SUPPLY
   power_supply::PowerSupplyRequester power_;
 #endif
@@ -113,10 +138,19 @@ class AddressableLightTransformer : public LightTransitionTransformer {
   optional<LightColorValues> apply() override;
 
  protected:
+  /// Fade every LED towards the target: led = add + led * keep, on the uncorrected values.
+  void blend_(const Color &add, uint8_t keep);
+  const uint8_t *get_uncorrection_tables_();
+
   AddressableLight &light_;
   Color target_color_{};
-  float last_transition_progress_{0.0f};
-  float accumulated_alpha_{0.0f};
+  // Both in Q16 fixed point
+  uint32_t last_transition_progress_{0};
+  uint32_t accumulated_alpha_{0};
+  // Lookup tables of the inverse color correction, built on first use
+  std::unique_ptr<uint8_t[]> uncorrection_tables_;
+  Color uncorrection_tables_max_{};
+  uint8_t uncorrection_tables_local_{0};
 };
 
 }  // namespace light
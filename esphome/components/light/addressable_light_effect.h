@@ -76,15 +76,14 @@ class AddressableRainbowLightEffect : public AddressableLightEffect {
  public:
   explicit AddressableRainbowLightEffect(const std::string &name) : AddressableLightEffect(name) {}
   void apply(AddressableLight &it, const Color &current_color) override {
-    ESPHSVColor hsv;
-    hsv.value = 255;
-    hsv.saturation = 240;
     uint16_t hue = (millis() * this->speed_) % 0xFFFF;
     const uint16_t add = 0xFFFF / this->width_;
-    for (auto var : it) {
-      hsv.hue = hue >> 8;
-      var = hsv;
-      hue += add;
+    // Convert and write the rainbow in chunks, to keep the buffer on the stack small
+    uint8_t rgb[32 * 3];
+    for (int32_t i = 0; i < it.size(); i += 32) {
+      const int32_t count = std::min<int32_t>(32, it.size() - i);
+      hue = hsv_ramp_to_rgb(hue, add, 240, 255, rgb, count);
+      it.write_pixels(i, count, rgb, PIXEL_FORMAT_RGB_KEEP_WHITE);
     }
     it.schedule_show();
   }
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "addressable_light.h"
+
+namespace esphome {
+namespace light {
+
+/// A contiguous range of the LEDs of another addressable light, exposed as a light of its own.
+///
+/// The segment has no buffer: its views point straight into the buffer of the parent light, so effects and transitions
+/// running on the segment write the driver buffer in place. Showing the segment only schedules a show of the parent,
+/// so all segments rendered in the same loop iteration are pushed to the hardware once.
+class AddressableLightSegment : public AddressableLight {
+ public:
+  AddressableLightSegment(LightState *parent, int32_t offset, int32_t size, bool reversed)
+      : parent_(static_cast<AddressableLight *>(parent->get_output())),
+        offset_(offset),
+        size_(size),
+        reversed_(reversed) {}
+
+  int32_t size() const override { return this->size_; }
+  void clear_effect_data() override {
+    for (int32_t i = 0; i < this->size_; i++)
+      this->get_view_internal(i).set_effect_data(0);
+  }
+  LightTraits get_traits() override { return this->parent_->get_traits(); }
+  void write_state(LightState *state) override {
+    this->parent_->schedule_show();
+    this->mark_shown_();
+  }
+
+ protected:
+  ESPColorView get_view_internal(int32_t index) const override {
+    int32_t src = this->reversed_ ? this->offset_ + this->size_ - index - 1 : this->offset_ + index;
+    ESPColorView view = this->parent_->get_view_internal(src);
+    view.raw_set_color_correction(&this->correction_);
+    return view;
+  }
+  bool has_flat_buffer_() const override { return this->parent_->has_flat_buffer_(); }
+
+  AddressableLight *parent_;
+  int32_t offset_;
+  int32_t size_;
+  bool reversed_;
+};
+
+}  // namespace light
+}  // namespace esphome
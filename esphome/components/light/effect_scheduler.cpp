@@ -0,0 +1,76 @@
+#include "effect_scheduler.h"
+#include "light_effect.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include <cinttypes>
+
+namespace esphome {
+namespace light {
+
+static const char *const TAG = "light.effect";
+
+static const uint32_t STATS_PERIOD = 10000;
+
+uint32_t EffectScheduler::budget_window_start_ = 0;
+uint32_t EffectScheduler::budget_used_ = 0;
+uint32_t EffectScheduler::waiting_ = 0;
+
+void EffectScheduler::reset() {
+  this->next_frame_ = micros();
+  if (this->deferred_) {
+    this->deferred_ = false;
+    waiting_--;
+  }
+  this->stats_start_ = millis();
+  this->stats_frames_ = 0;
+  this->frame_rate_ = 0.0f;
+  this->render_time_ = 0;
+  this->skipped_frames_ = 0;
+}
+
+void EffectScheduler::run(LightEffect *effect) {
+  uint32_t now = micros();
+  if ((int32_t) (now - this->next_frame_) < 0)
+    return;
+
+  const uint32_t now_ms = millis();
+  const uint32_t loop_interval = App.get_loop_interval();
+  if (now_ms - budget_window_start_ >= loop_interval) {
+    budget_window_start_ = now_ms;
+    budget_used_ = 0;
+  }
+  if (this->deferred_) {
+    this->deferred_ = false;
+    waiting_--;
+  } else if (waiting_ != 0 || budget_used_ >= loop_interval * 500) {
+    this->deferred_ = true;
+    waiting_++;
+    return;
+  }
+
+  effect->apply();
+  uint32_t render_time = micros() - now;
+  budget_used_ += render_time;
+  this->render_time_ = this->stats_frames_ == 0 ? render_time : (this->render_time_ * 7 + render_time) / 8;
+  this->stats_frames_++;
+
+  // Drop frames that are already late instead of catching up on them
+  this->next_frame_ += this->frame_interval_;
+  if ((int32_t) (now - this->next_frame_) >= 0) {
+    this->skipped_frames_ += (now - this->next_frame_) / this->frame_interval_ + 1;
+    this->next_frame_ = now + this->frame_interval_;
+  }
+
+  uint32_t elapsed = now_ms - this->stats_start_;
+  if (elapsed >= STATS_PERIOD) {
+    this->frame_rate_ = this->stats_frames_ * 1000.0f / elapsed;
+    this->stats_start_ = now_ms;
+    this->stats_frames_ = 0;
+    ESP_LOGV(TAG, "'%s': %.1f fps, %" PRIu32 " us per frame, %" PRIu32 " frames skipped", effect->get_name().c_str(),
+             this->frame_rate_, this->render_time_, this->skipped_frames_);
+  }
+}
+
+}  // namespace light
+}  // namespace esphome
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+
+namespace esphome {
+namespace light {
+
+class LightEffect;
+
+/// Paces the frames of the active effect of a light.
+///
+/// Frames are rendered at the configured frame rate. When the main loop cannot keep up, missed frames are dropped
+/// instead of being rendered back to back. All lights share a render budget of half the main loop interval: once the
+/// effects rendered in the current loop interval used it up, further frames wait for a later interval. While any light
+/// is waiting, the others yield to it, so lights take turns instead of the first ones in loop order always winning.
+class EffectScheduler {
+ public:
+  void set_frame_rate(float frame_rate) { this->frame_interval_ = frame_rate > 0 ? 1000000.0f / frame_rate : 0; }
+  bool has_frame_rate() const { return this->frame_interval_ != 0; }
+  float get_target_frame_rate() const { return this->frame_interval_ != 0 ? 1000000.0f / this->frame_interval_ : 0; }
+
+  /// Restart pacing and statistics, called when an effect is started or stopped.
+  void reset();
+  /// Render a frame of the effect if one is due.
+  void run(LightEffect *effect);
+
+  /// Frames per second rendered over the last statistics period.
+  float get_frame_rate() const { return this->frame_rate_; }
+  /// Average render time of a frame in microseconds.
+  uint32_t get_render_time() const { return this->render_time_; }
+  /// Frames dropped because the main loop or the render budget could not keep up.
+  uint32_t get_skipped_frames() const { return this->skipped_frames_; }
+
+ protected:
+  uint32_t frame_interval_{0};  ///< in µs
+  uint32_t next_frame_{0};
+  bool deferred_{false};
+
+  uint32_t stats_start_{0};
+  uint32_t stats_frames_{0};
+  float frame_rate_{0.0f};
+  uint32_t render_time_{0};
+  uint32_t skipped_frames_{0};
+
+  static uint32_t budget_window_start_;
+  static uint32_t budget_used_;
+  static uint32_t waiting_;
+};
+
+}  // namespace light
+}  // namespace esphome
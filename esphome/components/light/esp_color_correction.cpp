@@ -23,5 +23,23 @@ void ESPColorCorrection::calculate_gamma_table(float gamma) {
   }
 }
 
+void ESPColorCorrection::calculate_correction_tables(uint8_t *tables) const {
+  for (uint16_t i = 0; i < 256; i++) {
+    tables[i] = this->color_correct_red(i);
+    tables[256 + i] = this->color_correct_green(i);
+    tables[512 + i] = this->color_correct_blue(i);
+    tables[768 + i] = this->color_correct_white(i);
+  }
+}
+
+void ESPColorCorrection::calculate_uncorrection_tables(uint8_t *tables) const {
+  for (uint16_t i = 0; i < 256; i++) {
+    tables[i] = this->color_uncorrect_red(i);
+    tables[256 + i] = this->color_uncorrect_green(i);
+    tables[512 + i] = this->color_uncorrect_blue(i);
+    tables[768 + i] = this->color_uncorrect_white(i);
+  }
+}
+
 }  // namespace light
 }  // namespace esphome
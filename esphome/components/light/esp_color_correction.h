@@ -11,6 +11,12 @@ class ESPColorCorrection {
   void set_max_brightness(const Color &max_brightness) { this->max_brightness_ = max_brightness; }
   void set_local_brightness(uint8_t local_brightness) { this->local_brightness_ = local_brightness; }
   void calculate_gamma_table(float gamma);
+  /// Fill 4 x 256 lookup tables (red, green, blue, white) with the corrected value of every input.
+  void calculate_correction_tables(uint8_t *tables) const;
+  /// Fill 4 x 256 lookup tables (red, green, blue, white) with the uncorrected value of every input.
+  void calculate_uncorrection_tables(uint8_t *tables) const;
+  const Color &get_max_brightness() const { return this->max_brightness_; }
+  uint8_t get_local_brightness() const { return this->local_brightness_; }
   inline Color color_correct(Color color) const ESPHOME_ALWAYS_INLINE {
     // corrected = (uncorrected * max_brightness * local_brightness) ^ gamma
     return Color(this->color_correct_red(color.red), this->color_correct_green(color.green),
@@ -7,6 +7,9 @@
 namespace esphome {
 namespace light {
 
+class AddressableLight;
+class AddressableLightTransformer;
+
 class ESPColorSettable {
  public:
   virtual void set(const Color &color) = 0;
@@ -104,6 +107,9 @@ class ESPColorView : public ESPColorSettable {
   uint8_t *const white_;
   uint8_t *const effect_data_;
   const ESPColorCorrection *color_correction_;
+
+  friend AddressableLight;
+  friend AddressableLightTransformer;
 };
 
 }  // namespace light
@@ -3,11 +3,8 @@
 namespace esphome {
 namespace light {
 
-Color ESPHSVColor::to_rgb() const {
-  // based on FastLED's hsv rainbow to rgb
-  const uint8_t hue = this->hue;
-  const uint8_t sat = this->saturation;
-  const uint8_t val = this->value;
+// Fully saturated color of a hue at full value, based on FastLED's hsv rainbow to rgb
+static inline Color hue_to_rgb(uint8_t hue) {
   // upper 3 hue bits are for branch selection, lower 5 are for values
   const uint8_t offset8 = (hue & 0x1F) << 3;  // 0..248
   // third of the offset, 255/3 = 85 (actually only up to 82; 164)
@@ -58,6 +55,13 @@ Color ESPHSVColor::to_rgb() const {
     default:
       break;
   }
+  return rgb;
+}
+
+Color ESPHSVColor::to_rgb() const {
+  Color rgb = hue_to_rgb(this->hue);
+  const uint8_t sat = this->saturation;
+  const uint8_t val = this->value;
   // low saturation -> add uniform color to orig. hue
   // high saturation -> use hue directly
   // scales with square of saturation
@@ -70,5 +74,19 @@ Color ESPHSVColor::to_rgb() const {
   return rgb;
 }
 
+uint16_t hsv_ramp_to_rgb(uint16_t hue, uint16_t step, uint8_t saturation, uint8_t value, uint8_t *rgb, size_t count) {
+  const uint8_t desat = 255 - saturation;
+  // never overflows a channel, so no saturating add is needed
+  const uint32_t add = esp_scale8(desat, desat) * 0x01010101UL;
+  for (size_t i = 0; i < count; i++, hue += step, rgb += 3) {
+    Color color = hue_to_rgb(hue >> 8);
+    color.raw_32 = esp_scale8_x4(esp_scale8_x4(color.raw_32, saturation) + add, value);
+    rgb[0] = color.r;
+    rgb[1] = color.g;
+    rgb[2] = color.b;
+  }
+  return hue;
+}
+
 }  // namespace light
 }  // namespace esphome
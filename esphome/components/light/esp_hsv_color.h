@@ -32,5 +32,9 @@ struct ESPHSVColor {
   Color to_rgb() const;
 };
 
+/// Convert a rainbow of `count` colors to packed RGB bytes, the same as ESPHSVColor::to_rgb() on each. The hue is in
+/// 8.8 fixed point and advances by `step` for every color; the hue after the last color is returned.
+uint16_t hsv_ramp_to_rgb(uint16_t hue, uint16_t step, uint8_t saturation, uint8_t value, uint8_t *rgb, size_t count);
+
 }  // namespace light
 }  // namespace esphome
@@ -94,6 +94,9 @@ void LightState::dump_config() {
     ESP_LOGCONFIG(TAG, "  Default Transition Length: %.1fs", this->default_transition_length_ / 1e3f);
     ESP_LOGCONFIG(TAG, "  Gamma Correct: %.2f", this->gamma_correct_);
   }
+  if (this->effect_scheduler_.has_frame_rate()) {
+    ESP_LOGCONFIG(TAG, "  Effect Frame Rate: %.1f fps", this->effect_scheduler_.get_target_frame_rate());
+  }
   if (this->get_traits().supports_color_capability(ColorCapability::COLOR_TEMPERATURE)) {
     ESP_LOGCONFIG(TAG, "  Min Mireds: %.1f", this->get_traits().get_min_mireds());
     ESP_LOGCONFIG(TAG, "  Max Mireds: %.1f", this->get_traits().get_max_mireds());
@@ -103,7 +106,11 @@ void LightState::loop() {
   // Apply effect (if any)
   auto *effect = this->get_active_effect_();
   if (effect != nullptr) {
-    effect->apply();
+    if (this->effect_scheduler_.has_frame_rate()) {
+      this->effect_scheduler_.run(effect);
+    } else {
+      effect->apply();
+    }
   }
 
   // Apply transformer (if any)
@@ -216,6 +223,7 @@ void LightState::start_effect_(uint32_t effect_index) {
   this->active_effect_index_ = effect_index;
   auto *effect = this->get_active_effect_();
   effect->start_internal();
+  this->effect_scheduler_.reset();
 }
 LightEffect *LightState::get_active_effect_() {
   if (this->active_effect_index_ == 0) {
@@ -228,6 +236,7 @@ void LightState::stop_effect_() {
   auto *effect = this->get_active_effect_();
   if (effect != nullptr) {
     effect->stop();
+    this->effect_scheduler_.reset();
   }
   this->active_effect_index_ = 0;
 }
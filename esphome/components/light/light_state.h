@@ -5,6 +5,7 @@
 #include "esphome/core/optional.h"
 #include "esphome/core/preferences.h"
 #include "light_call.h"
+#include "effect_scheduler.h"
 #include "light_color_values.h"
 #include "light_effect.h"
 #include "light_traits.h"
@@ -157,6 +158,11 @@ class LightState : public EntityBase, public Component {
   /// Add effects for this light state.
   void add_effects(const std::vector<LightEffect *> &effects);
 
+  /// Set the frame rate effects are rendered at. Without one, effects are applied on every loop iteration.
+  void set_effect_frame_rate(float frame_rate) { this->effect_scheduler_.set_frame_rate(frame_rate); }
+  /// Get the frame scheduler of the active effect, for its achieved frame rate and render time.
+  const EffectScheduler &get_effect_scheduler() const { return this->effect_scheduler_; }
+
   /// The result of all the current_values_as_* methods have gamma correction applied.
   void current_values_as_binary(bool *binary);
 
@@ -248,6 +254,8 @@ class LightState : public EntityBase, public Component {
   optional<LightStateRTCState> initial_state_{};
   /// List of effects for this light.
   std::vector<LightEffect *> effects_;
+  /// Paces the frames of the active effect, if a frame rate is set.
+  EffectScheduler effect_scheduler_;
 
   // for effects, true if a transformer (transition) is active.
   bool is_transformer_active_ = false;
@@ -7,6 +7,9 @@
 namespace esphome {
 namespace light {
 
+/// 1.0 in the Q16 fixed point format used for transition progress.
+static const uint32_t Q16_ONE = 1 << 16;
+
 /// Base class for all light color transformers, such as transitions or flashes.
 class LightTransformer {
  public:
@@ -21,7 +24,7 @@ class LightTransformer {
   }
 
   /// Indicates whether this transformation is finished.
-  virtual bool is_finished() { return this->get_progress_() >= 1.0f; }
+  virtual bool is_finished() { return this->get_progress_q16_() >= Q16_ONE; }
 
   /// This will be called before the transition is started.
   virtual void start() {}
@@ -49,6 +52,17 @@ class LightTransformer {
     return clamp((now - this->start_time_) / float(this->length_), 0.0f, 1.0f);
   }
 
+  /// The progress of this transition in Q16 fixed point, on a scale of 0 to Q16_ONE.
+  uint32_t get_progress_q16_() {
+    uint32_t now = esphome::millis();
+    if (now < this->start_time_)
+      return 0;
+    if (now >= this->start_time_ + this->length_)
+      return Q16_ONE;
+
+    return (uint64_t(now - this->start_time_) << 16) / this->length_;
+  }
+
   uint32_t start_time_;
   uint32_t length_;
   LightColorValues start_values_;
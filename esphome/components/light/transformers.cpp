@@ -0,0 +1,28 @@
+#include "light_output.h"
+#include "transformers.h"
+
+namespace esphome {
+namespace light {
+
+// 6x^5 - 15x^4 + 10x^3 at x = i / 64, in Q16
+static const uint16_t SMOOTHED_PROGRESS_TABLE[65] = {
+    0, 2, 19, 63, 145, 277, 467, 723, 1052, 1460, 1951, 2529, 3196,
+    3955, 4806, 5749, 6784, 7909, 9121, 10418, 11797, 13253, 14781, 16378, 18036, 19751,
+    21515, 23323, 25168, 27042, 28938, 30849, 32768, 34687, 36598, 38494, 40368, 42213, 44021,
+    45785, 47500, 49158, 50755, 52283, 53739, 55118, 56415, 57627, 58752, 59787, 60730, 61581,
+    62340, 63007, 63585, 64076, 64484, 64813, 65069, 65259, 65391, 65473, 65517, 65534, 65535,
+};
+
+uint32_t LightTransitionTransformer::smoothed_progress_q16(uint32_t x) {
+  if (x >= Q16_ONE)
+    return Q16_ONE;
+  // Interpolate linearly between the two closest samples
+  uint32_t index = x >> 10;
+  uint32_t fraction = x & 0x3FF;
+  uint32_t lo = SMOOTHED_PROGRESS_TABLE[index];
+  uint32_t hi = SMOOTHED_PROGRESS_TABLE[index + 1];
+  return lo + (((hi - lo) * fraction) >> 10);
+}
+
+}  // namespace light
+}  // namespace esphome
@@ -36,28 +36,31 @@ class LightTransitionTransformer : public LightTransformer {
   }
 
   optional<LightColorValues> apply() override {
-    float p = this->get_progress_();
+    uint32_t p = this->get_progress_q16_();
+    const uint32_t half = Q16_ONE / 2;
 
     // Halfway through, when intermediate state (off) is reached, flip it to the target, but remain off.
-    if (this->changing_color_mode_ && p > 0.5f &&
+    if (this->changing_color_mode_ && p > half &&
         this->intermediate_values_.get_color_mode() != this->target_values_.get_color_mode()) {
       this->intermediate_values_ = this->target_values_;
       this->intermediate_values_.set_state(false);
     }
 
-    LightColorValues &start = this->changing_color_mode_ && p > 0.5f ? this->intermediate_values_ : this->start_values_;
-    LightColorValues &end = this->changing_color_mode_ && p < 0.5f ? this->intermediate_values_ : this->end_values_;
+    LightColorValues &start = this->changing_color_mode_ && p > half ? this->intermediate_values_ : this->start_values_;
+    LightColorValues &end = this->changing_color_mode_ && p < half ? this->intermediate_values_ : this->end_values_;
     if (this->changing_color_mode_)
-      p = p < 0.5f ? p * 2 : (p - 0.5) * 2;
+      p = p < half ? p * 2 : (p - half) * 2;
 
-    float v = LightTransitionTransformer::smoothed_progress(p);
-    return LightColorValues::lerp(start, end, v);
+    uint32_t v = LightTransitionTransformer::smoothed_progress_q16(p);
+    return LightColorValues::lerp(start, end, v / float(Q16_ONE));
   }
 
  protected:
   // This looks crazy, but it reduces to 6x^5 - 15x^4 + 10x^3 which is just a smooth sigmoid-like
   // transition from 0 to 1 on x = [0, 1]
   static float smoothed_progress(float x) { return x * x * x * (x * (x * 6.0f - 15.0f) + 10.0f); }
+  /// smoothed_progress() in Q16 fixed point, looked up from a table so it needs no floating point math.
+  static uint32_t smoothed_progress_q16(uint32_t x);
 
   bool changing_color_mode_{false};
   LightColorValues end_values_{};
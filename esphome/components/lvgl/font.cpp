@@ -11,7 +11,7 @@ static const uint8_t *get_glyph_bitmap(const lv_font_t *font, uint32_t unicode_l
     return nullptr;
   // esph_log_d(TAG, "Returning bitmap @  %X", (uint32_t)gd->data);
 
-  return gd->data;
+  return fe->get_glyph_bitmap(gd);
 }
 
 static bool get_glyph_dsc_cb(const lv_font_t *font, lv_font_glyph_dsc_t *dsc, uint32_t unicode_letter, uint32_t next) {
@@ -43,6 +43,18 @@ FontEngine::FontEngine(font::Font *esp_font) : font_(esp_font) {
 
 const lv_font_t *FontEngine::get_lv_font() { return &this->lv_font_; }
 
+const uint8_t *FontEngine::get_glyph_bitmap(const font::GlyphData *gd) {
+  if (!this->font_->is_compressed())
+    return gd->data;
+  // LVGL wants a plain bitmap, unpack the glyph it is about to draw.
+  if (gd != this->bitmap_glyph_) {
+    this->bitmap_.resize((gd->width * gd->height * this->bpp + 7) / 8);
+    this->font_->decode_glyph(gd, this->bitmap_.data());
+    this->bitmap_glyph_ = gd;
+  }
+  return this->bitmap_.data();
+}
+
 const font::GlyphData *FontEngine::get_glyph_data(uint32_t unicode_letter) {
   if (unicode_letter == last_letter_)
     return this->last_data_;
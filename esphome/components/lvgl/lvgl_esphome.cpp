@@ -5,6 +5,7 @@
 #include "lvgl_hal.h"
 #include "lvgl_esphome.h"
 
+#include <algorithm>
 #include <numeric>
 
 namespace esphome {
@@ -138,6 +139,37 @@ void LvglComponent::show_prev_page(lv_scr_load_anim_t anim, uint32_t time) {
   } while (this->pages_[this->current_page_]->skip);  // skip empty pages()
   this->show_page(this->current_page_, anim, time);
 }
+// Side of the square tiles used when rotating by 90 or 270 degrees.
+static const lv_coord_t ROTATE_TILE_SIZE = 16;
+
+/**
+ * Copy a width x height block of pixels into dst, rotated by 90 degrees (clockwise) or 270 degrees.
+ *
+ * A plain transpose reads sequentially but writes with a stride of a whole row, so every write touches a different
+ * cache line. Working through square tiles keeps both the rows read and the rows written within a few cache lines.
+ */
+static void rotate_tiled(const lv_color_t *src, lv_color_t *dst, lv_coord_t width, lv_coord_t height,
+                         bool clockwise) {
+  for (lv_coord_t row_start = 0; row_start < height; row_start += ROTATE_TILE_SIZE) {
+    const lv_coord_t row_end = std::min<lv_coord_t>(row_start + ROTATE_TILE_SIZE, height);
+    for (lv_coord_t col_start = 0; col_start < width; col_start += ROTATE_TILE_SIZE) {
+      const lv_coord_t col_end = std::min<lv_coord_t>(col_start + ROTATE_TILE_SIZE, width);
+      for (lv_coord_t row = row_start; row != row_end; row++) {
+        const lv_color_t *in = src + row * width;
+        if (clockwise) {
+          lv_color_t *out = dst + height - 1 - row;
+          for (lv_coord_t col = col_start; col != col_end; col++)
+            out[col * height] = in[col];
+        } else {
+          lv_color_t *out = dst + row;
+          for (lv_coord_t col = col_start; col != col_end; col++)
+            out[(width - 1 - col) * height] = in[col];
+        }
+      }
+    }
+  }
+}
+
 void LvglComponent::draw_buffer_(const lv_area_t *area, lv_color_t *ptr) {
   auto width = lv_area_get_width(area);
   auto height = lv_area_get_height(area);
@@ -146,11 +178,7 @@ void LvglComponent::draw_buffer_(const lv_area_t *area, lv_color_t *ptr) {
   lv_color_t *dst = this->rotate_buf_;
   switch (this->rotation) {
     case display::DISPLAY_ROTATION_90_DEGREES:
-      for (lv_coord_t x = height; x-- != 0;) {
-        for (lv_coord_t y = 0; y != width; y++) {
-          dst[y * height + x] = *ptr++;
-        }
-      }
+      rotate_tiled(ptr, dst, width, height, true);
       y1 = x1;
       x1 = this->disp_drv_.ver_res - area->y1 - height;
       width = height;
@@ -158,21 +186,13 @@ void LvglComponent::draw_buffer_(const lv_area_t *area, lv_color_t *ptr) {
       break;
 
     case display::DISPLAY_ROTATION_180_DEGREES:
-      for (lv_coord_t y = height; y-- != 0;) {
-        for (lv_coord_t x = width; x-- != 0;) {
-          dst[y * width + x] = *ptr++;
-        }
-      }
+      std::reverse_copy(ptr, ptr + width * height, dst);
       x1 = this->disp_drv_.hor_res - x1 - width;
       y1 = this->disp_drv_.ver_res - y1 - height;
       break;
 
     case display::DISPLAY_ROTATION_270_DEGREES:
-      for (lv_coord_t x = 0; x != height; x++) {
-        for (lv_coord_t y = width; y-- != 0;) {
-          dst[y * height + x] = *ptr++;
-        }
-      }
+      rotate_tiled(ptr, dst, width, height, false);
       x1 = y1;
       y1 = this->disp_drv_.hor_res - area->x1 - width;
       width = height;
@@ -192,10 +212,12 @@ void LvglComponent::draw_buffer_(const lv_area_t *area, lv_color_t *ptr) {
 
 void LvglComponent::flush_cb_(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p) {
   if (!this->paused_) {
-    auto now = millis();
+    auto now = micros();
     this->draw_buffer_(area, color_p);
-    ESP_LOGVV(TAG, "flush_cb, area=%d/%d, %d/%d took %dms", area->x1, area->y1, lv_area_get_width(area),
-              lv_area_get_height(area), (int) (millis() - now));
+    auto elapsed = micros() - now;
+    this->flush_us_ += elapsed;
+    ESP_LOGVV(TAG, "flush_cb, area=%d/%d, %d/%d took %uus", area->x1, area->y1, lv_area_get_width(area),
+              lv_area_get_height(area), (unsigned) elapsed);
   }
   lv_disp_flush_ready(disp_drv);
 }
@@ -426,6 +448,7 @@ LvglComponent::LvglComponent(std::vector<display::Display *> displays, float buf
   this->disp_drv_.user_data = this;
   this->disp_drv_.full_refresh = this->full_refresh_;
   this->disp_drv_.flush_cb = static_flush_cb;
+  this->disp_drv_.monitor_cb = static_monitor_cb;
   this->disp_drv_.rounder_cb = rounder_cb;
   this->disp_drv_.hor_res = (lv_coord_t) display->get_width();
   this->disp_drv_.ver_res = (lv_coord_t) display->get_height();
@@ -458,6 +481,22 @@ void LvglComponent::setup() {
 }
 
 void LvglComponent::update() {
+  auto now = millis();
+  if (this->frame_stats_callbacks_.size() != 0 && now != this->stats_start_) {
+    float render_ms = NAN;
+    float flush_ms = NAN;
+    if (this->frame_count_ != 0) {
+      // Flushing happens from within the LVGL timer handler, so it is part of the busy time.
+      render_ms = (this->busy_us_ - std::min(this->flush_us_, this->busy_us_)) / 1000.0f / this->frame_count_;
+      flush_ms = this->flush_us_ / 1000.0f / this->frame_count_;
+    }
+    float fps = this->frame_count_ * 1000.0f / (now - this->stats_start_);
+    this->frame_stats_callbacks_.call(render_ms, flush_ms, fps);
+  }
+  this->stats_start_ = now;
+  this->frame_count_ = 0;
+  this->busy_us_ = 0;
+  this->flush_us_ = 0;
   // update indicators
   if (this->paused_) {
     return;
@@ -469,7 +508,9 @@ void LvglComponent::loop() {
     if (this->show_snow_)
       this->write_random_();
   }
+  auto start = micros();
   lv_timer_handler_run_in_period(5);
+  this->busy_us_ += micros() - start;
 }
 
 #ifdef USE_LVGL_ANIMIMG
@@ -484,6 +525,10 @@ void lv_animimg_stop(lv_obj_t *obj) {
 void LvglComponent::static_flush_cb(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p) {
   reinterpret_cast<LvglComponent *>(disp_drv->user_data)->flush_cb_(disp_drv, area, color_p);
 }
+// Called by LVGL after each refresh of the screen.
+void LvglComponent::static_monitor_cb(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px) {
+  reinterpret_cast<LvglComponent *>(disp_drv->user_data)->frame_count_++;
+}
 }  // namespace lvgl
 }  // namespace esphome
 
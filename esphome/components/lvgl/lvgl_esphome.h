@@ -99,6 +99,7 @@ class FontEngine {
   const lv_font_t *get_lv_font();
 
   const font::GlyphData *get_glyph_data(uint32_t unicode_letter);
+  const uint8_t *get_glyph_bitmap(const font::GlyphData *gd);
   uint16_t baseline{};
   uint16_t height{};
   uint8_t bpp{};
@@ -107,6 +108,8 @@ class FontEngine {
   font::Font *font_{};
   uint32_t last_letter_{};
   const font::GlyphData *last_data_{};
+  const font::GlyphData *bitmap_glyph_{};
+  std::vector<uint8_t> bitmap_;
   lv_font_t lv_font_{};
 };
 #endif  // USE_LVGL_FONT
@@ -121,6 +124,7 @@ class LvglComponent : public PollingComponent {
   LvglComponent(std::vector<display::Display *> displays, float buffer_frac, bool full_refresh, int draw_rounding,
                 bool resume_on_input);
   static void static_flush_cb(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p);
+  static void static_monitor_cb(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px);
 
   float get_setup_priority() const override { return setup_priority::PROCESSOR; }
   void setup() override;
@@ -130,6 +134,13 @@ class LvglComponent : public PollingComponent {
     this->idle_callbacks_.add(std::move(callback));
   }
   void add_on_pause_callback(std::function<void(bool)> &&callback) { this->pause_callbacks_.add(std::move(callback)); }
+  /**
+   * Called on every update with the average render and flush time of a frame in ms since the previous update,
+   * and the number of frames per second. The times are NAN if no frame was drawn.
+   */
+  void add_on_frame_stats_callback(std::function<void(float, float, float)> &&callback) {
+    this->frame_stats_callbacks_.add(std::move(callback));
+  }
   void dump_config() override;
   bool is_idle(uint32_t idle_ms) { return lv_disp_get_inactive_time(this->disp_) > idle_ms; }
   lv_disp_t *get_disp() { return this->disp_; }
@@ -189,7 +200,14 @@ class LvglComponent : public PollingComponent {
 
   CallbackManager<void(uint32_t)> idle_callbacks_{};
   CallbackManager<void(bool)> pause_callbacks_{};
+  CallbackManager<void(float, float, float)> frame_stats_callbacks_{};
   lv_color_t *rotate_buf_{};
+
+  // Frame statistics since the last update
+  uint32_t stats_start_{};
+  uint32_t frame_count_{};
+  uint32_t busy_us_{};
+  uint32_t flush_us_{};
 };
 
 class IdleTrigger : public Trigger<> {
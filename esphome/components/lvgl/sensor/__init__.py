@@ -16,20 +16,40 @@ from ..schemas import LVGL_SCHEMA
 from ..types import LV_EVENT, LvNumber
 from ..widgets import Widget, get_widgets, wait_for_widgets
 
-CONFIG_SCHEMA = (
+CONF_FRAME_STAT = "frame_stat"
+
+# Argument names of the frame stats callback, see LvglComponent::add_on_frame_stats_callback()
+FRAME_STATS = {
+    "RENDER_TIME": "render_ms",
+    "FLUSH_TIME": "flush_ms",
+    "FPS": "fps",
+}
+
+CONFIG_SCHEMA = cv.All(
     sensor_schema(Sensor)
     .extend(LVGL_SCHEMA)
     .extend(
         {
-            cv.Required(CONF_WIDGET): cv.use_id(LvNumber),
+            cv.Exclusive(CONF_WIDGET, CONF_WIDGET): cv.use_id(LvNumber),
+            cv.Exclusive(CONF_FRAME_STAT, CONF_WIDGET): cv.enum(
+                FRAME_STATS, upper=True, space="_"
+            ),
         }
-    )
+    ),
+    cv.has_exactly_one_key(CONF_WIDGET, CONF_FRAME_STAT),
 )
 
 
 async def to_code(config):
     sensor = await new_sensor(config)
     paren = await cg.get_variable(config[CONF_LVGL_ID])
+    if stat := config.get(CONF_FRAME_STAT):
+        async with LambdaContext(
+            [(cg.float_, arg) for arg in FRAME_STATS.values()]
+        ) as lamb:
+            lv_add(sensor.publish_state(cg.RawExpression(FRAME_STATS[stat])))
+        cg.add(paren.add_on_frame_stats_callback(await lamb.get_lambda()))
+        return
     widget = await get_widgets(config, CONF_WIDGET)
     widget = widget[0]
     assert isinstance(widget, Widget)
@@ -28,6 +28,7 @@ class M5Stack8AngleLightOutput : public light::AddressableLight, public Parented
 
  protected:
   light::ESPColorView get_view_internal(int32_t index) const override;
+  bool has_flat_buffer_() const override { return true; }
 
   uint8_t *buf_{nullptr};
   uint8_t *effect_data_{nullptr};
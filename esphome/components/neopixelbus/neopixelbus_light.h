@@ -101,6 +101,8 @@ class NeoPixelBusLightOutputBase : public light::AddressableLight {
   }
 
  protected:
+  bool has_flat_buffer_() const override { return true; }
+
   NeoPixelBus<T_COLOR_FEATURE, T_METHOD> *controller_{nullptr};
   uint8_t *effect_data_{nullptr};
   uint8_t rgb_offsets_[4]{0, 1, 2, 3};
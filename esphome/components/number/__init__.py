@@ -288,7 +288,10 @@ NUMBER_IN_RANGE_CONDITION_SCHEMA = cv.All(
 
 
 @automation.register_condition(
-    "number.in_range", NumberInRangeCondition, NUMBER_IN_RANGE_CONDITION_SCHEMA
+    "number.in_range",
+    NumberInRangeCondition,
+    NUMBER_IN_RANGE_CONDITION_SCHEMA,
+    reactive=True,
 )
 async def number_in_range_to_code(config, condition_id, template_arg, args):
     paren = await cg.get_variable(config[CONF_ID])
@@ -2,6 +2,7 @@ import logging
 
 from esphome import automation
 import esphome.codegen as cg
+from esphome.components import display
 from esphome.components.http_request import CONF_HTTP_REQUEST_ID, HttpRequestComponent
 from esphome.components.image import (
     CONF_USE_TRANSPARENCY,
@@ -10,11 +11,17 @@ from esphome.components.image import (
     validate_cross_dependencies,
 )
 import esphome.config_validation as cv
+import esphome.final_validate as fv
 from esphome.const import (
+    CONF_AUTO_CLEAR_ENABLED,
     CONF_BUFFER_SIZE,
+    CONF_DISPLAY,
+    CONF_DITHER,
     CONF_FORMAT,
     CONF_ID,
+    CONF_LAMBDA,
     CONF_ON_ERROR,
+    CONF_PAGES,
     CONF_RESIZE,
     CONF_TRIGGER_ID,
     CONF_TYPE,
@@ -28,6 +35,10 @@ MULTI_CONF = True
 
 CONF_ON_DOWNLOAD_FINISHED = "on_download_finished"
 CONF_PLACEHOLDER = "placeholder"
+CONF_STREAM = "stream"
+CONF_X = "x"
+CONF_Y = "y"
+CONF_MAX_BUFFER_SIZE = "max_buffer_size"
 
 _LOGGER = logging.getLogger(__name__)
 
@@ -57,6 +68,15 @@ DownloadErrorTrigger = online_image_ns.class_(
     "DownloadErrorTrigger", automation.Trigger.template()
 )
 
+STREAM_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_DISPLAY): cv.use_id(display.Display),
+        cv.Optional(CONF_X, default=0): cv.int_,
+        cv.Optional(CONF_Y, default=0): cv.int_,
+        cv.Optional(CONF_MAX_BUFFER_SIZE, default=4096): cv.int_range(min=256),
+    }
+)
+
 ONLINE_IMAGE_SCHEMA = cv.Schema(
     {
         cv.Required(CONF_ID): cv.declare_id(OnlineImage),
@@ -76,6 +96,10 @@ ONLINE_IMAGE_SCHEMA = cv.Schema(
         cv.Required(CONF_FORMAT): cv.enum(IMAGE_FORMAT, upper=True),
         cv.Optional(CONF_PLACEHOLDER): cv.use_id(Image_),
         cv.Optional(CONF_BUFFER_SIZE, default=2048): cv.int_range(256, 65536),
+        cv.Optional(CONF_STREAM): STREAM_SCHEMA,
+        cv.Optional(CONF_DITHER, default="NONE"): cv.one_of(
+            "NONE", "ORDERED", upper=True
+        ),
         cv.Optional(CONF_ON_DOWNLOAD_FINISHED): automation.validate_automation(
             {
                 cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(DownloadFinishedTrigger),
@@ -102,6 +126,29 @@ CONFIG_SCHEMA = cv.Schema(
     )
 )
 
+def _final_validate(config):
+    # Streamed rows are drawn into the display outside of its update(). A display that
+    # clears or redraws itself on update would overwrite them before they are shown.
+    if CONF_STREAM not in config:
+        return config
+    global_config = fv.full_config.get()
+    path = global_config.get_path_for_id(config[CONF_STREAM][CONF_DISPLAY])[:-1]
+    display_config = global_config.get_config_for_path(path)
+    if CONF_LAMBDA in display_config or CONF_PAGES in display_config:
+        raise cv.Invalid(
+            "The display of a streamed image must not have a lambda or pages",
+            [CONF_STREAM, CONF_DISPLAY],
+        )
+    if display_config.get(CONF_AUTO_CLEAR_ENABLED, False):
+        raise cv.Invalid(
+            "The display of a streamed image must set auto_clear_enabled: false",
+            [CONF_STREAM, CONF_DISPLAY],
+        )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
 SET_URL_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.use_id(OnlineImage),
@@ -154,6 +201,17 @@ async def to_code(config):
 
     cg.add(var.set_transparency(transparent))
 
+    if stream := config.get(CONF_STREAM):
+        disp = await cg.get_variable(stream[CONF_DISPLAY])
+        cg.add(
+            var.set_stream(
+                disp, stream[CONF_X], stream[CONF_Y], stream[CONF_MAX_BUFFER_SIZE]
+            )
+        )
+
+    if config[CONF_DITHER] == "ORDERED":
+        cg.add(var.set_ordered_dither(True))
+
     if placeholder_id := config.get(CONF_PLACEHOLDER):
         placeholder = await cg.get_variable(placeholder_id)
         cg.add(var.set_placeholder(placeholder))
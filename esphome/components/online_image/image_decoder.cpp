@@ -17,8 +17,10 @@ void ImageDecoder::set_size(int width, int height) {
 void ImageDecoder::draw(int x, int y, int w, int h, const Color &color) {
   auto width = std::min(this->image_->buffer_width_, static_cast<int>(std::ceil((x + w) * this->x_scale_)));
   auto height = std::min(this->image_->buffer_height_, static_cast<int>(std::ceil((y + h) * this->y_scale_)));
-  for (int i = x * this->x_scale_; i < width; i++) {
-    for (int j = y * this->y_scale_; j < height; j++) {
+  const int top = y * this->y_scale_;
+  this->image_->prepare_rows_(top, height);
+  for (int j = top; j < height; j++) {
+    for (int i = x * this->x_scale_; i < width; i++) {
       this->image_->draw_pixel_(i, j, color);
     }
   }
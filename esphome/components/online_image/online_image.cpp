@@ -15,13 +15,16 @@ namespace online_image {
 
 using image::ImageType;
 
-inline bool is_color_on(const Color &color) {
+// 4x4 Bayer matrix for ordered dithering, which only depends on the pixel position and thus works while streaming.
+static const uint8_t BAYER_4X4[16] = {0, 8, 2, 10, 12, 4, 14, 6, 3, 11, 1, 9, 15, 7, 13, 5};
+
+inline bool is_color_on(const Color &color, uint8_t threshold = 0x80) {
   // This produces the most accurate monochrome conversion, but is slightly slower.
   //  return (0.2125 * color.r + 0.7154 * color.g + 0.0721 * color.b) > 127;
 
   // Approximation using fast integer computations; produces acceptable results
   // Equivalent to 0.25 * R + 0.5 * G + 0.25 * B
-  return ((color.r >> 2) + (color.g >> 1) + (color.b >> 2)) & 0x80;
+  return ((color.r >> 2) + (color.g >> 1) + (color.b >> 2)) >= threshold;
 }
 
 OnlineImage::OnlineImage(const std::string &url, int width, int height, ImageFormat format, ImageType type,
@@ -53,6 +56,8 @@ void OnlineImage::release() {
     this->height_ = 0;
     this->buffer_width_ = 0;
     this->buffer_height_ = 0;
+    this->band_y_ = 0;
+    this->band_height_ = 0;
     this->end_connection_();
   }
 }
@@ -70,13 +75,24 @@ bool OnlineImage::resize_(int width_in, int height_in) {
   if (this->buffer_) {
     return false;
   }
-  auto new_size = this->get_buffer_size_(width, height);
+  int band_height = height;
+  if (this->stream_display_ != nullptr) {
+    // All rows scaled from one decoded row must fit in the band, or they would be flushed half drawn.
+    const int min_rows = (height + height_in - 1) / height_in + 1;
+    band_height = std::max(min_rows, static_cast<int>(this->stream_buffer_size_ / this->get_buffer_size_(width, 1)));
+    band_height = std::min(band_height, height);
+  }
+  auto new_size = this->get_buffer_size_(width, band_height);
   ESP_LOGD(TAG, "Allocating new buffer of %d Bytes...", new_size);
   delay_microseconds_safe(2000);
   this->buffer_ = this->allocator_.allocate(new_size);
   if (this->buffer_) {
+    // Rows of a streamed image are drawn as a whole, so start from a defined state.
+    memset(this->buffer_, 0, new_size);
     this->buffer_width_ = width;
     this->buffer_height_ = height;
+    this->band_y_ = 0;
+    this->band_height_ = band_height;
     this->width_ = width;
     ESP_LOGD(TAG, "New size: (%d, %d)", width, height);
   } else {
@@ -126,6 +142,7 @@ void OnlineImage::update() {
   }
 
   ESP_LOGD(TAG, "Starting download");
+  this->band_y_ = 0;
   size_t total_size = this->downloader_->content_length;
 
 #ifdef USE_ONLINE_IMAGE_PNG_SUPPORT
@@ -151,9 +168,19 @@ void OnlineImage::loop() {
   }
   if (!this->downloader_ || this->decoder_->is_finished()) {
     ESP_LOGD(TAG, "Image fully downloaded");
-    this->data_start_ = buffer_;
-    this->width_ = buffer_width_;
-    this->height_ = buffer_height_;
+    if (this->stream_display_ != nullptr) {
+      // The image has been drawn already, only the last band is left.
+      if (this->buffer_) {
+        this->flush_band_();
+        this->allocator_.deallocate(this->buffer_, this->get_buffer_size_());
+        this->buffer_ = nullptr;
+      }
+      this->width_ = 0;
+    } else {
+      this->data_start_ = buffer_;
+      this->width_ = buffer_width_;
+      this->height_ = buffer_height_;
+    }
     this->end_connection_();
     this->download_finished_callback_.call();
     return;
@@ -188,12 +215,27 @@ void OnlineImage::draw_pixel_(int x, int y, Color color) {
     ESP_LOGE(TAG, "Tried to paint a pixel (%d,%d) outside the image!", x, y);
     return;
   }
+  // Without streaming the band holds the whole image, so this only happens while streaming.
+  if (y >= this->band_y_ + this->band_height_) {
+    this->flush_band_();
+    this->band_y_ = y;
+  } else if (y < this->band_y_) {
+    // The row has been flushed already, e.g. by an earlier pass of an interlaced image; draw straight to the display.
+    if (this->has_transparency() && color.w < 0x80)
+      return;
+    if (this->type_ == ImageType::IMAGE_TYPE_BINARY)
+      color = is_color_on(color) ? display::COLOR_ON : display::COLOR_OFF;
+    this->stream_display_->draw_pixel_at(this->stream_x_ + x, this->stream_y_ + y, color);
+    return;
+  }
+  const uint8_t dither = this->ordered_dither_ ? BAYER_4X4[(y & 3) * 4 + (x & 3)] : 0;
   uint32_t pos = this->get_position_(x, y);
   switch (this->type_) {
     case ImageType::IMAGE_TYPE_BINARY: {
       const uint32_t width_8 = ((this->width_ + 7u) / 8u) * 8u;
-      const uint32_t pos = x + y * width_8;
-      if ((this->has_transparency() && color.w > 127) || is_color_on(color)) {
+      const uint32_t pos = x + (y - this->band_y_) * width_8;
+      const uint8_t threshold = this->ordered_dither_ ? dither * 16 + 8 : 0x80;
+      if ((this->has_transparency() && color.w > 127) || is_color_on(color, threshold)) {
         this->buffer_[pos / 8u] |= (0x80 >> (pos % 8u));
       } else {
         this->buffer_[pos / 8u] &= ~(0x80 >> (pos % 8u));
@@ -214,6 +256,12 @@ void OnlineImage::draw_pixel_(int x, int y, Color color) {
       break;
     }
     case ImageType::IMAGE_TYPE_RGB565: {
+      if (this->ordered_dither_) {
+        // Spread the bits lost by the 5 and 6 bit channels over neighbouring pixels.
+        color.r = std::min(color.r + (dither >> 1), 255);
+        color.g = std::min(color.g + (dither >> 2), 255);
+        color.b = std::min(color.b + (dither >> 1), 255);
+      }
       uint16_t col565 = display::ColorUtil::color_to_565(color);
       this->buffer_[pos + 0] = static_cast<uint8_t>((col565 >> 8) & 0xFF);
       this->buffer_[pos + 1] = static_cast<uint8_t>(col565 & 0xFF);
@@ -248,6 +296,24 @@ void OnlineImage::draw_pixel_(int x, int y, Color color) {
   }
 }
 
+void OnlineImage::prepare_rows_(int y_begin, int y_end) {
+  if (this->stream_display_ != nullptr && y_end > this->band_y_ + this->band_height_ && y_begin > this->band_y_) {
+    this->flush_band_();
+    this->band_y_ = y_begin;
+  }
+}
+
+void OnlineImage::flush_band_() {
+  // Image::draw blits the band in the storage format, the same way as a whole image.
+  this->data_start_ = this->buffer_;
+  this->height_ = std::min(this->band_height_, this->buffer_height_ - this->band_y_);
+  Image::draw(this->stream_x_, this->stream_y_ + this->band_y_, this->stream_display_, display::COLOR_ON,
+              display::COLOR_OFF);
+  this->data_start_ = nullptr;
+  this->height_ = 0;
+  memset(this->buffer_, 0, this->get_buffer_size_());
+}
+
 void OnlineImage::end_connection_() {
   if (this->downloader_) {
     this->downloader_->end();
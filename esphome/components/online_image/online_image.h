@@ -70,6 +70,34 @@ class OnlineImage : public PollingComponent,
    */
   void set_placeholder(image::Image *placeholder) { this->placeholder_ = placeholder; }
 
+  /**
+   * @brief Draw the image straight to a display while it is being decoded, instead of
+   * keeping a buffer with the whole image.
+   *
+   * Decoded rows are collected in a band of at most max_buffer_size bytes, which is
+   * drawn to the display every time it is full. Once the download finishes, the band
+   * is freed, so drawing the image afterwards only shows the placeholder.
+   * Later passes of interlaced images are drawn pixel by pixel, unless the band holds the whole image.
+   *
+   * The rows are drawn outside of the display's update(), so the display must not clear or redraw itself:
+   * it must have no lambda or pages and auto clear must be disabled. Buffered displays show the rows on
+   * their next update.
+   *
+   * @param display The display to draw to.
+   * @param x Horizontal position of the image on the display.
+   * @param y Vertical position of the image on the display.
+   * @param max_buffer_size Maximum number of bytes used for decoded rows.
+   */
+  void set_stream(display::Display *display, int x, int y, uint32_t max_buffer_size) {
+    this->stream_display_ = display;
+    this->stream_x_ = x;
+    this->stream_y_ = y;
+    this->stream_buffer_size_ = max_buffer_size;
+  }
+
+  /** Apply ordered dithering when reducing colors to binary or RGB565 images. */
+  void set_ordered_dither(bool ordered_dither) { this->ordered_dither_ = ordered_dither; }
+
   /**
    * Release the buffer storing the image. The image will need to be downloaded again
    * to be able to be displayed.
@@ -85,10 +113,12 @@ class OnlineImage : public PollingComponent,
   using Allocator = ExternalRAMAllocator<uint8_t>;
   Allocator allocator_{Allocator::Flags::ALLOW_FAILURE};
 
-  uint32_t get_buffer_size_() const { return get_buffer_size_(this->buffer_width_, this->buffer_height_); }
+  uint32_t get_buffer_size_() const { return get_buffer_size_(this->buffer_width_, this->band_height_); }
   int get_buffer_size_(int width, int height) const { return (this->get_bpp() * width + 7u) / 8u * height; }
 
-  int get_position_(int x, int y) const { return (x + y * this->buffer_width_) * this->get_bpp() / 8; }
+  int get_position_(int x, int y) const {
+    return (x + (y - this->band_y_) * this->buffer_width_) * this->get_bpp() / 8;
+  }
 
   ESPHOME_ALWAYS_INLINE bool auto_resize_() const { return this->fixed_width_ == 0 || this->fixed_height_ == 0; }
 
@@ -107,6 +137,17 @@ class OnlineImage : public PollingComponent,
    */
   void draw_pixel_(int x, int y, Color color);
 
+  /** Draw the rows decoded into the band to the stream display, and clear it for the next rows. */
+  void flush_band_();
+
+  /**
+   * @brief Make sure the rows in [y_begin, y_end) can be drawn into the buffer.
+   *
+   * While streaming, this flushes the band and moves it to y_begin once y_end does not fit in
+   * it anymore, so that all rows scaled from the same decoded row end up in the same band.
+   */
+  void prepare_rows_(int y_begin, int y_end);
+
   void end_connection_();
 
   CallbackManager<void()> download_finished_callback_{};
@@ -145,6 +186,18 @@ class OnlineImage : public PollingComponent,
    * decoded images).
    */
   int buffer_height_;
+  /**
+   * First image row held by the buffer, and number of rows it can hold. Without streaming
+   * the buffer holds the whole image, so these are 0 and buffer_height_.
+   */
+  int band_y_{0};
+  int band_height_{0};
+
+  display::Display *stream_display_{nullptr};
+  int stream_x_{0};
+  int stream_y_{0};
+  uint32_t stream_buffer_size_{0};
+  bool ordered_dither_{false};
 
   friend void ImageDecoder::set_size(int width, int height);
   friend void ImageDecoder::draw(int x, int y, int w, int h, const Color &color);
@@ -20,6 +20,9 @@ AddressableSegment = partitions_ns.class_("AddressableSegment")
 AddressableLightWrapper = cg.esphome_ns.namespace("light").class_(
     "AddressableLightWrapper"
 )
+AddressableLightSegment = cg.esphome_ns.namespace("light").class_(
+    "AddressableLightSegment", light.AddressableLight
+)
 PartitionLightOutput = partitions_ns.class_(
     "PartitionLightOutput", light.AddressableLight
 )
@@ -95,6 +98,23 @@ FINAL_VALIDATE_SCHEMA = cv.Schema(
 
 
 async def to_code(config):
+    if len(segments := config[CONF_SEGMENTS]) == 1 and CONF_ID in segments[0]:
+        # A single range of one strip maps straight onto the strip's buffer
+        conf = segments[0]
+        var = cg.Pvariable(
+            config[CONF_OUTPUT_ID],
+            AddressableLightSegment.new(
+                await cg.get_variable(conf[CONF_ID]),
+                conf[CONF_FROM],
+                conf[CONF_TO] - conf[CONF_FROM] + 1,
+                conf[CONF_REVERSED],
+            ),
+            AddressableLightSegment,
+        )
+        await cg.register_component(var, config)
+        await light.register_light(var, config)
+        return
+
     segments = []
     for conf in config[CONF_SEGMENTS]:
         if CONF_SINGLE_LIGHT_ID in conf:
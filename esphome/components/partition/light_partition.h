@@ -5,6 +5,7 @@
 
 #include "esphome/core/component.h"
 #include "esphome/components/light/addressable_light.h"
+#include "esphome/components/light/addressable_light_segment.h"
 
 namespace esphome {
 namespace partition {
@@ -0,0 +1,22 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components.light.types import AddressableLightEffect
+
+AUTO_LOAD = ["socket"]
+DEPENDENCIES = ["network"]
+
+pixel_protocol_ns = cg.esphome_ns.namespace("pixel_protocol")
+PixelProtocolComponent = pixel_protocol_ns.class_(
+    "PixelProtocolComponent", cg.Component
+)
+PixelProtocolLightEffect = pixel_protocol_ns.class_(
+    "PixelProtocolLightEffect", AddressableLightEffect
+)
+
+CHANNELS = {
+    "MONO": pixel_protocol_ns.PIXEL_CHANNELS_MONO,
+    "RGB": pixel_protocol_ns.PIXEL_CHANNELS_RGB,
+    "RGBW": pixel_protocol_ns.PIXEL_CHANNELS_RGBW,
+}
+
+CONFIG_SCHEMA = cv.Schema({})
@@ -0,0 +1,262 @@
+#include "pixel_protocol.h"
+#ifdef USE_NETWORK
+#include "pixel_protocol_light_effect.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <new>
+
+namespace esphome {
+namespace pixel_protocol {
+
+static const char *const TAG = "pixel_protocol";
+// Upper bound of datagrams read per loop, so a flood cannot starve other components
+static const int MAX_PACKETS_PER_LOOP = 64;
+// Without a sync for this long, frames are shown as soon as they are received again
+static const uint32_t SYNC_TIMEOUT = 4000;
+// Frames staged in addition to the packets that cover the lights, for senders that split frames differently
+static const size_t STAGING_SLACK = 2;
+// Staged frames that were not updated for this long are freed
+static const uint32_t FRAME_TIMEOUT = 4000;
+
+static uint64_t frame_key(uint16_t universe, uint32_t offset) { return (uint64_t(universe) << 32) | offset; }
+
+void PixelProtocolComponent::setup() {
+  this->receive_buffer_.reset(new uint8_t[this->get_max_packet_size_()]);
+  this->socket_ = socket::socket_ip(SOCK_DGRAM, IPPROTO_IP);
+
+  int enable = 1;
+  int err = this->socket_->setsockopt(SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(int));
+  if (err != 0) {
+    ESP_LOGW(TAG, "Socket unable to set reuseaddr: errno %d", err);
+    // we can still continue
+  }
+  err = this->socket_->setblocking(false);
+  if (err != 0) {
+    ESP_LOGW(TAG, "Socket unable to set nonblocking mode: errno %d", err);
+    this->mark_failed();
+    return;
+  }
+
+  struct sockaddr_storage server;
+
+  socklen_t sl = socket::set_sockaddr_any((struct sockaddr *) &server, sizeof(server), this->get_port_());
+  if (sl == 0) {
+    ESP_LOGW(TAG, "Socket unable to set sockaddr: errno %d", errno);
+    this->mark_failed();
+    return;
+  }
+
+  err = this->socket_->bind((struct sockaddr *) &server, sizeof(server));
+  if (err != 0) {
+    ESP_LOGW(TAG, "Socket unable to bind: errno %d", errno);
+    this->mark_failed();
+    return;
+  }
+}
+
+void PixelProtocolComponent::loop() {
+  bool sync = false;
+
+  // Drain all pending datagrams, keeping only the latest packet of every universe and offset
+  for (int i = 0; i < MAX_PACKETS_PER_LOOP; i++) {
+    ssize_t len = this->socket_->read(this->receive_buffer_.get(), this->get_max_packet_size_());
+    if (len == -1) {
+      break;
+    }
+
+    PixelPacket packet;
+    switch (this->parse_(this->receive_buffer_.get(), len, packet)) {
+      case PIXEL_PACKET_INVALID:
+        ESP_LOGV(TAG, "Invalid %s packet received of size %zd.", this->get_protocol_name_(), len);
+        continue;
+      case PIXEL_PACKET_IGNORED:
+        continue;
+      case PIXEL_PACKET_SYNC:
+        sync = true;
+        continue;
+      case PIXEL_PACKET_DATA:
+        break;
+    }
+
+    sync |= packet.push;
+    this->stage_(packet);
+  }
+
+  const uint32_t now = millis();
+  for (auto &frame : this->frames_) {
+    if (!frame.pending)
+      continue;
+    frame.pending = false;
+    this->apply_(frame.packet);
+  }
+  this->frames_.erase(std::remove_if(this->frames_.begin(), this->frames_.end(),
+                                     [now](const Frame &frame) { return now - frame.last_update > FRAME_TIMEOUT; }),
+                      this->frames_.end());
+
+  if (sync) {
+    this->last_sync_ = now;
+    this->synced_ = true;
+  } else if (this->synced_ && now - this->last_sync_ > SYNC_TIMEOUT) {
+    ESP_LOGD(TAG, "No %s sync received, showing frames as they arrive.", this->get_protocol_name_());
+    this->synced_ = false;
+  }
+  if (sync || !this->synced_)
+    this->show_();
+}
+
+void PixelProtocolComponent::add_effect(PixelProtocolLightEffect *light_effect) {
+  if (this->light_effects_.count(light_effect)) {
+    return;
+  }
+
+  ESP_LOGD(TAG, "Registering '%s' for %s universes %d-%d.", light_effect->get_name().c_str(),
+           this->get_protocol_name_(), light_effect->get_first_universe(), light_effect->get_last_universe());
+
+  this->light_effects_.insert(light_effect);
+
+  for (auto universe = light_effect->get_first_universe(); universe <= light_effect->get_last_universe(); ++universe) {
+    auto &slot = this->universes_[universe];
+    slot.effects.push_back(light_effect);
+    if (slot.effects.size() == 1)
+      this->join_(universe);
+  }
+  this->update_staging_limit_();
+}
+
+void PixelProtocolComponent::remove_effect(PixelProtocolLightEffect *light_effect) {
+  if (!this->light_effects_.count(light_effect)) {
+    return;
+  }
+
+  ESP_LOGD(TAG, "Unregistering '%s' for %s universes %d-%d.", light_effect->get_name().c_str(),
+           this->get_protocol_name_(), light_effect->get_first_universe(), light_effect->get_last_universe());
+
+  this->light_effects_.erase(light_effect);
+
+  for (auto universe = light_effect->get_first_universe(); universe <= light_effect->get_last_universe(); ++universe) {
+    auto it = this->universes_.find(universe);
+    if (it == this->universes_.end())
+      continue;
+    auto &effects = it->second.effects;
+    effects.erase(std::remove(effects.begin(), effects.end(), light_effect), effects.end());
+    if (!effects.empty())
+      continue;  // we have other consumers of the given universe
+
+    this->universes_.erase(it);
+    this->frames_.erase(std::remove_if(this->frames_.begin(), this->frames_.end(),
+                                       [universe](const Frame &frame) { return frame.packet.universe == universe; }),
+                        this->frames_.end());
+    this->leave_(universe);
+  }
+  this->update_staging_limit_();
+}
+
+void PixelProtocolComponent::update_staging_limit_() {
+  const size_t packet_size = this->get_max_packet_size_();
+  size_t frames = 0;
+  for (auto *light_effect : this->light_effects_) {
+    if (light_effect->universe_size_ == 0) {
+      // A single universe addressed by offset, split into packets by the sender
+      size_t bytes = size_t(light_effect->get_addressable_()->size()) * light_effect->channels_;
+      frames += (bytes + packet_size - 1) / packet_size;
+    } else {
+      frames += light_effect->get_universe_count();
+    }
+  }
+  if (frames != 0)
+    frames += STAGING_SLACK;
+
+  this->max_frames_ = frames;
+  if (this->frames_.size() > frames)
+    this->frames_.resize(frames);
+  if (frames == 0) {
+    this->frames_.shrink_to_fit();
+  } else {
+    this->frames_.reserve(frames);
+  }
+}
+
+bool PixelProtocolComponent::accept_sequence_(Universe &universe, uint8_t sequence) {
+  if (sequence == 0)
+    return true;
+  // Drop duplicates and packets that arrive shortly after a newer one, but accept large jumps as a sender restart
+  auto diff = static_cast<int8_t>(sequence - universe.sequence);
+  if (universe.sequence != 0 && diff <= 0 && diff > -20)
+    return false;
+  universe.sequence = sequence;
+  return true;
+}
+
+void PixelProtocolComponent::stage_(const PixelPacket &packet) {
+  auto it = this->universes_.find(packet.universe);
+  if (it == this->universes_.end()) {
+    ESP_LOGV(TAG, "Ignored %s packet for %d universe of size %d.", this->get_protocol_name_(), packet.universe,
+             packet.count);
+    return;
+  }
+  if (!this->accept_sequence_(it->second, packet.sequence)) {
+    ESP_LOGV(TAG, "Out of order %s packet for %d universe dropped.", this->get_protocol_name_(), packet.universe);
+    return;
+  }
+
+  // Only stage packets that some light shows, as the offsets are chosen by the sender
+  bool covered = false;
+  for (auto *light_effect : it->second.effects)
+    covered = covered || light_effect->covers_(packet);
+  if (!covered) {
+    ESP_LOGV(TAG, "Ignored %s packet for %d universe at offset %" PRIu32 ".", this->get_protocol_name_(),
+             packet.universe, packet.offset);
+    return;
+  }
+
+  const uint64_t key = frame_key(packet.universe, packet.offset);
+  auto frame_it = std::find_if(this->frames_.begin(), this->frames_.end(),
+                               [key](const Frame &frame) { return frame.key == key; });
+  if (frame_it == this->frames_.end()) {
+    // Packets beyond the staging limit are written right away instead of being staged
+    if (this->frames_.size() >= this->max_frames_) {
+      this->apply_(packet);
+      return;
+    }
+    std::unique_ptr<uint8_t[]> buffer(new (std::nothrow) uint8_t[this->get_max_packet_size_()]);
+    if (!buffer) {
+      this->apply_(packet);
+      return;
+    }
+    this->frames_.emplace_back();
+    frame_it = this->frames_.end() - 1;
+    frame_it->key = key;
+    frame_it->buffer = std::move(buffer);
+  }
+  auto &frame = *frame_it;
+  // The packet points into the receive buffer, which becomes the buffer of the frame
+  std::swap(this->receive_buffer_, frame.buffer);
+  frame.packet = packet;
+  frame.last_update = millis();
+  frame.pending = true;
+}
+
+void PixelProtocolComponent::apply_(const PixelPacket &packet) {
+  auto universe = this->universes_.find(packet.universe);
+  if (universe == this->universes_.end())
+    return;
+  bool handled = false;
+  for (auto *light_effect : universe->second.effects) {
+    handled = light_effect->process_(packet) || handled;
+  }
+  if (!handled) {
+    ESP_LOGV(TAG, "Ignored %s packet for %d universe of size %d.", this->get_protocol_name_(), packet.universe,
+             packet.count);
+  }
+}
+
+void PixelProtocolComponent::show_() {
+  for (auto *light_effect : this->light_effects_)
+    light_effect->show_();
+}
+
+}  // namespace pixel_protocol
+}  // namespace esphome
+#endif
@@ -0,0 +1,104 @@
+#pragma once
+#include "esphome/core/defines.h"
+#ifdef USE_NETWORK
+#include "esphome/components/socket/socket.h"
+#include "esphome/core/component.h"
+
+#include <cinttypes>
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace esphome {
+namespace pixel_protocol {
+
+class PixelProtocolLightEffect;
+
+/// Channel values of a received datagram, pointing into the datagram buffer.
+struct PixelPacket {
+  uint16_t universe{0};
+  /// Index of the first value within the universe.
+  uint32_t offset{0};
+  uint16_t count{0};
+  const uint8_t *values{nullptr};
+  /// Sequence number, 0 if the sender does not number its packets.
+  uint8_t sequence{0};
+  /// Whether the packet completes a frame that should be shown.
+  bool push{false};
+};
+
+enum PixelPacketType {
+  PIXEL_PACKET_INVALID,
+  /// Channel values, decoded into a PixelPacket.
+  PIXEL_PACKET_DATA,
+  /// A sync packet: show the frames received so far.
+  PIXEL_PACKET_SYNC,
+  /// A valid packet that carries no channel values.
+  PIXEL_PACKET_IGNORED,
+};
+
+/// Common receiver of UDP pixel protocols.
+///
+/// Every loop drains all pending datagrams, decoded in place by the protocol front-end. The latest packet of every
+/// universe and offset is kept in a staging buffer that is swapped with the receive buffer, so nothing is copied and
+/// superseded packets are never applied. Staging is limited to the packets needed to cover the lights of the
+/// registered effects, and frames that stop being updated are freed. The staged packets are then written to the
+/// lights of their effects. Once a sender uses push flags or sync packets, lights are shown only when a frame is
+/// complete; that mode lapses when no sync was received for SYNC_TIMEOUT.
+class PixelProtocolComponent : public Component {
+ public:
+  void setup() override;
+  void loop() override;
+  float get_setup_priority() const override { return setup_priority::AFTER_WIFI; }
+
+  void add_effect(PixelProtocolLightEffect *light_effect);
+  void remove_effect(PixelProtocolLightEffect *light_effect);
+
+ protected:
+  struct Universe {
+    std::vector<PixelProtocolLightEffect *> effects;
+    uint8_t sequence{0};
+  };
+  /// Latest packet received for a universe and offset.
+  struct Frame {
+    uint64_t key{0};
+    std::unique_ptr<uint8_t[]> buffer;
+    PixelPacket packet;
+    uint32_t last_update{0};
+    bool pending{false};
+  };
+
+  virtual const char *get_protocol_name_() const = 0;
+  virtual uint16_t get_port_() const = 0;
+  virtual size_t get_max_packet_size_() const = 0;
+  /// Decode a datagram in place, the packet values must point into `data`.
+  virtual PixelPacketType parse_(const uint8_t *data, size_t len, PixelPacket &packet) = 0;
+  /// Called when the first effect subscribes to a universe.
+  virtual void join_(uint16_t universe) {}
+  /// Called when the last effect unsubscribes from a universe.
+  virtual void leave_(uint16_t universe) {}
+
+  /// Size the staging area for the packets of the registered effects.
+  void update_staging_limit_();
+  bool accept_sequence_(Universe &universe, uint8_t sequence);
+  void stage_(const PixelPacket &packet);
+  /// Write a packet to the lights of its universe.
+  void apply_(const PixelPacket &packet);
+  void show_();
+
+  std::unique_ptr<socket::Socket> socket_;
+  std::set<PixelProtocolLightEffect *> light_effects_;
+  std::map<uint16_t, Universe> universes_;
+  // Reserved up to max_frames_, so staging a frame never allocates more than its buffer
+  std::vector<Frame> frames_;
+  size_t max_frames_{0};
+  // Datagrams are received here and swapped with the frame they update
+  std::unique_ptr<uint8_t[]> receive_buffer_;
+  uint32_t last_sync_{0};
+  bool synced_{false};
+};
+
+}  // namespace pixel_protocol
+}  // namespace esphome
+#endif
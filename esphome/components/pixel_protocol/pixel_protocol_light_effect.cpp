@@ -0,0 +1,131 @@
+#include "pixel_protocol_light_effect.h"
+#include "pixel_protocol.h"
+#ifdef USE_NETWORK
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace pixel_protocol {
+
+static const char *const TAG = "pixel_protocol_light_effect";
+
+PixelProtocolLightEffect::PixelProtocolLightEffect(const std::string &name) : AddressableLightEffect(name) {}
+
+int PixelProtocolLightEffect::get_lights_per_universe() const {
+  if (this->universe_size_ == 0)
+    return this->get_addressable_()->size();
+  return this->universe_size_ / this->channels_;
+}
+
+int PixelProtocolLightEffect::get_last_universe() const {
+  return this->first_universe_ + this->get_universe_count() - 1;
+}
+
+int PixelProtocolLightEffect::get_universe_count() const {
+  if (this->universe_size_ == 0)
+    return 1;
+  // Round up to lights_per_universe
+  auto lights = this->get_lights_per_universe();
+  return (this->get_addressable_()->size() + lights - 1) / lights;
+}
+
+void PixelProtocolLightEffect::start() {
+  AddressableLightEffect::start();
+
+  if (this->source_) {
+    this->source_->add_effect(this);
+  }
+}
+
+void PixelProtocolLightEffect::stop() {
+  if (this->source_) {
+    this->source_->remove_effect(this);
+  }
+
+  AddressableLightEffect::stop();
+}
+
+void PixelProtocolLightEffect::apply(light::AddressableLight &it, const Color &current_color) {
+  // ignore, it is run by `PixelProtocolComponent::loop()`
+}
+
+bool PixelProtocolLightEffect::covers_(const PixelPacket &packet) const {
+  if (packet.universe < this->first_universe_ || packet.universe > this->get_last_universe())
+    return false;
+  const uint64_t channels = this->channels_;
+  uint64_t first = 0;
+  uint64_t last = uint64_t(this->get_lights_per_universe()) * channels;
+  if (this->universe_size_ == 0) {
+    // A single universe addressed by offset, starting at the first pixel of the light
+    first = this->start_pixel_ * channels;
+    last += first;
+  }
+  return packet.offset < last && uint64_t(packet.offset) + packet.count > first;
+}
+
+bool PixelProtocolLightEffect::process_(const PixelPacket &packet) {
+  auto *it = this->get_addressable_();
+
+  // check if this is our universe
+  if (packet.universe < this->first_universe_ || packet.universe > this->get_last_universe())
+    return false;
+
+  const uint32_t channels = this->channels_;
+  // Skip the rest of a pixel that started in the previous packet
+  uint32_t skip = (channels - packet.offset % channels) % channels;
+  if (packet.count < skip + channels)
+    return false;
+  uint32_t pixel = (packet.offset + skip) / channels;
+  uint32_t count = (packet.count - skip) / channels;
+  const uint8_t *data = packet.values + skip;
+
+  if (this->universe_size_ != 0) {
+    // limit amount of lights per universe
+    uint32_t lights = this->get_lights_per_universe();
+    if (pixel >= lights)
+      return false;
+    count = std::min(count, lights - pixel);
+    pixel += (packet.universe - this->first_universe_) * lights;
+  }
+
+  // drop the pixels in front of the light
+  if (pixel < this->start_pixel_) {
+    uint32_t before = this->start_pixel_ - pixel;
+    if (count <= before)
+      return false;
+    count -= before;
+    data += before * channels;
+    pixel = this->start_pixel_;
+  }
+  pixel -= this->start_pixel_;
+
+  ESP_LOGV(TAG, "Applying data for '%s' on %d universe, for %" PRIu32 "-%" PRIu32 ".", this->get_name().c_str(),
+           packet.universe, pixel, pixel + count);
+
+  switch (this->channels_) {
+    case PIXEL_CHANNELS_MONO:
+      it->write_pixels(pixel, count, data, light::PIXEL_FORMAT_MONO);
+      break;
+
+    case PIXEL_CHANNELS_RGB:
+      it->write_pixels(pixel, count, data, light::PIXEL_FORMAT_RGB_WHITE_AVERAGE);
+      break;
+
+    case PIXEL_CHANNELS_RGBW:
+      it->write_pixels(pixel, count, data, light::PIXEL_FORMAT_RGBW);
+      break;
+  }
+
+  this->dirty_ = true;
+  return true;
+}
+
+void PixelProtocolLightEffect::show_() {
+  if (!this->dirty_)
+    return;
+  this->dirty_ = false;
+  this->get_addressable_()->schedule_show();
+}
+
+}  // namespace pixel_protocol
+}  // namespace esphome
+#endif
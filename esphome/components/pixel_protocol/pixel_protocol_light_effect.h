@@ -0,0 +1,56 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/components/light/addressable_light_effect.h"
+#ifdef USE_NETWORK
+namespace esphome {
+namespace pixel_protocol {
+
+class PixelProtocolComponent;
+struct PixelPacket;
+
+enum PixelChannels { PIXEL_CHANNELS_MONO = 1, PIXEL_CHANNELS_RGB = 3, PIXEL_CHANNELS_RGBW = 4 };
+
+/// Shows the pixels received by a PixelProtocolComponent on an addressable light.
+///
+/// The light spans consecutive universes starting at the first universe, each holding as many whole pixels as fit in
+/// the universe size. A universe size of 0 means a single universe addressed by offset.
+class PixelProtocolLightEffect : public light::AddressableLightEffect {
+ public:
+  PixelProtocolLightEffect(const std::string &name);
+
+  void start() override;
+  void stop() override;
+  void apply(light::AddressableLight &it, const Color &current_color) override;
+
+  int get_lights_per_universe() const;
+  int get_first_universe() const { return this->first_universe_; }
+  int get_last_universe() const;
+  int get_universe_count() const;
+
+  void set_first_universe(int universe) { this->first_universe_ = universe; }
+  void set_universe_size(uint16_t universe_size) { this->universe_size_ = universe_size; }
+  void set_start_pixel(uint32_t start_pixel) { this->start_pixel_ = start_pixel; }
+  void set_channels(PixelChannels channels) { this->channels_ = channels; }
+  void set_source(PixelProtocolComponent *source) { this->source_ = source; }
+
+ protected:
+  /// Whether the packet holds values of pixels of this light.
+  bool covers_(const PixelPacket &packet) const;
+  bool process_(const PixelPacket &packet);
+  void show_();
+
+  int first_universe_{0};
+  uint16_t universe_size_{0};
+  uint32_t start_pixel_{0};
+  PixelChannels channels_{PIXEL_CHANNELS_RGB};
+  PixelProtocolComponent *source_{nullptr};
+  // Written since the light was last shown
+  bool dirty_{false};
+
+  friend class PixelProtocolComponent;
+};
+
+}  // namespace pixel_protocol
+}  // namespace esphome
+#endif
@@ -5,347 +5,421 @@
 namespace esphome {
 namespace prometheus {
 
-void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
-  AsyncResponseStream *stream = req->beginResponseStream("text/plain; version=0.0.4; charset=utf-8");
+static const char *const CONTENT_TYPE = "text/plain; version=0.0.4; charset=utf-8";
 
+void PrometheusHandler::setup() {
 #ifdef USE_SENSOR
-  this->sensor_type_(stream);
   for (auto *obj : App.get_sensors())
-    this->sensor_row_(stream, obj);
+    this->add_labels_(obj);
 #endif
-
 #ifdef USE_BINARY_SENSOR
-  this->binary_sensor_type_(stream);
   for (auto *obj : App.get_binary_sensors())
-    this->binary_sensor_row_(stream, obj);
+    this->add_labels_(obj);
 #endif
-
 #ifdef USE_FAN
-  this->fan_type_(stream);
   for (auto *obj : App.get_fans())
-    this->fan_row_(stream, obj);
+    this->add_labels_(obj);
 #endif
-
 #ifdef USE_LIGHT
-  this->light_type_(stream);
   for (auto *obj : App.get_lights())
-    this->light_row_(stream, obj);
+    this->add_labels_(obj);
 #endif
-
 #ifdef USE_COVER
-  this->cover_type_(stream);
   for (auto *obj : App.get_covers())
-    this->cover_row_(stream, obj);
+    this->add_labels_(obj);
 #endif
-
 #ifdef USE_SWITCH
-  this->switch_type_(stream);
   for (auto *obj : App.get_switches())
-    this->switch_row_(stream, obj);
+    this->add_labels_(obj);
 #endif
-
 #ifdef USE_LOCK
-  this->lock_type_(stream);
   for (auto *obj : App.get_locks())
-    this->lock_row_(stream, obj);
+    this->add_labels_(obj);
+#endif
+  // The relabel maps are baked into the label cache, no need to keep them around
+  this->relabel_map_id_.clear();
+  this->relabel_map_name_.clear();
+
+  this->base_->init();
+  this->base_->add_handler(this);
+}
+
+void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
+  // Stream the exposition in chunks instead of building it in memory; only the rows of a single entity are buffered.
+  auto state = std::make_shared<ScrapeState>();
+  AsyncWebServerResponse *response = req->beginChunkedResponse(
+      CONTENT_TYPE, [this, state](uint8_t *buffer, size_t max_len, size_t /*index*/) -> size_t {
+        return this->fill_(*state, buffer, max_len);
+      });
+  req->send(response);
+}
+
+size_t PrometheusHandler::fill_(ScrapeState &state, uint8_t *buffer, size_t max_len) {
+  size_t written = 0;
+  while (written < max_len) {
+    if (state.pending_pos >= state.pending.size() && !this->render_next_(state))
+      break;
+    const size_t len = std::min(state.pending.size() - state.pending_pos, max_len - written);
+    memcpy(buffer + written, state.pending.data() + state.pending_pos, len);
+    state.pending_pos += len;
+    written += len;
+  }
+  return written;
+}
+
+bool PrometheusHandler::render_next_(ScrapeState &state) {
+  state.pending.clear();
+  state.pending_pos = 0;
+  while (state.section != SECTION_DONE) {
+    // Rows of internal entities may be skipped, keep going until something was rendered
+    if (!state.pending.empty())
+      return true;
+    switch (state.section) {
+#ifdef USE_SENSOR
+      case SECTION_SENSOR: {
+        const auto &objs = App.get_sensors();
+        if (state.index == 0)
+          this->sensor_type_(state.pending);
+        if (state.index < objs.size()) {
+          this->sensor_row_(state.pending, objs[state.index++]);
+          continue;
+        }
+        break;
+      }
+#endif
+#ifdef USE_BINARY_SENSOR
+      case SECTION_BINARY_SENSOR: {
+        const auto &objs = App.get_binary_sensors();
+        if (state.index == 0)
+          this->binary_sensor_type_(state.pending);
+        if (state.index < objs.size()) {
+          this->binary_sensor_row_(state.pending, objs[state.index++]);
+          continue;
+        }
+        break;
+      }
+#endif
+#ifdef USE_FAN
+      case SECTION_FAN: {
+        const auto &objs = App.get_fans();
+        if (state.index == 0)
+          this->fan_type_(state.pending);
+        if (state.index < objs.size()) {
+          this->fan_row_(state.pending, objs[state.index++]);
+          continue;
+        }
+        break;
+      }
 #endif
+#ifdef USE_LIGHT
+      case SECTION_LIGHT: {
+        const auto &objs = App.get_lights();
+        if (state.index == 0)
+          this->light_type_(state.pending);
+        if (state.index < objs.size()) {
+          this->light_row_(state.pending, objs[state.index++]);
+          continue;
+        }
+        break;
+      }
+#endif
+#ifdef USE_COVER
+      case SECTION_COVER: {
+        const auto &objs = App.get_covers();
+        if (state.index == 0)
+          this->cover_type_(state.pending);
+        if (state.index < objs.size()) {
+          this->cover_row_(state.pending, objs[state.index++]);
+          continue;
+        }
+        break;
+      }
+#endif
+#ifdef USE_SWITCH
+      case SECTION_SWITCH: {
+        const auto &objs = App.get_switches();
+        if (state.index == 0)
+          this->switch_type_(state.pending);
+        if (state.index < objs.size()) {
+          this->switch_row_(state.pending, objs[state.index++]);
+          continue;
+        }
+        break;
+      }
+#endif
+#ifdef USE_LOCK
+      case SECTION_LOCK: {
+        const auto &objs = App.get_locks();
+        if (state.index == 0)
+          this->lock_type_(state.pending);
+        if (state.index < objs.size()) {
+          this->lock_row_(state.pending, objs[state.index++]);
+          continue;
+        }
+        break;
+      }
+#endif
+      default:
+        break;
+    }
+    // Current section is exhausted, move on to the next one
+    state.section++;
+    state.index = 0;
+  }
+  return !state.pending.empty();
+}
+
+static void append_escaped(std::string &out, const std::string &value) {
+  for (char c : value) {
+    switch (c) {
+      case '\\':
+        out.append("\\\\");
+        break;
+      case '"':
+        out.append("\\\"");
+        break;
+      case '\n':
+        out.append("\\n");
+        break;
+      default:
+        out += c;
+        break;
+    }
+  }
+}
+
+void PrometheusHandler::add_labels_(EntityBase *obj) {
+  if (obj->is_internal() && !this->include_internal_)
+    return;
+  auto id = this->relabel_map_id_.find(obj);
+  auto name = this->relabel_map_name_.find(obj);
+  std::string labels = "id=\"";
+  append_escaped(labels, id == this->relabel_map_id_.end() ? obj->get_object_id() : id->second);
+  labels.append("\",name=\"");
+  append_escaped(labels, name == this->relabel_map_name_.end() ? obj->get_name().str() : name->second);
+  labels += '"';
+  this->labels_map_[obj] = std::move(labels);
+}
+
+const std::string &PrometheusHandler::labels_(EntityBase *obj) { return this->labels_map_[obj]; }
+
+/// Start a row: `metric{id="...",name="..."`
+static void begin_row(std::string &out, const char *metric, const std::string &labels) {
+  out.append(metric);
+  out += '{';
+  out.append(labels);
+}
 
-  req->send(stream);
+/// Finish a row with an integer value.
+static void end_row(std::string &out, int value) {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "} %d\n", value);
+  out.append(buf);
 }
 
-std::string PrometheusHandler::relabel_id_(EntityBase *obj) {
-  auto item = relabel_map_id_.find(obj);
-  return item == relabel_map_id_.end() ? obj->get_object_id() : item->second;
+/// Finish a row with a float value, keeping full precision.
+static void end_row(std::string &out, float value) {
+  out.append("} ");
+  out.append(to_string(value));
+  out += '\n';
 }
 
-std::string PrometheusHandler::relabel_name_(EntityBase *obj) {
-  auto item = relabel_map_name_.find(obj);
-  return item == relabel_map_name_.end() ? obj->get_name() : item->second;
+/// Finish a row with a float value rounded to the entity's accuracy.
+static void end_row(std::string &out, float value, int8_t accuracy_decimals) {
+  out.append("} ");
+  out.append(value_accuracy_to_string(value, accuracy_decimals));
+  out += '\n';
 }
 
 // Type-specific implementation
 #ifdef USE_SENSOR
-void PrometheusHandler::sensor_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_sensor_value gauge\n"));
-  stream->print(F("#TYPE esphome_sensor_failed gauge\n"));
+void PrometheusHandler::sensor_type_(std::string &out) {
+  out.append("#TYPE esphome_sensor_value gauge\n");
+  out.append("#TYPE esphome_sensor_failed gauge\n");
 }
-void PrometheusHandler::sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj) {
+void PrometheusHandler::sensor_row_(std::string &out, sensor::Sensor *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
+  const std::string &labels = this->labels_(obj);
   if (!std::isnan(obj->state)) {
     // We have a valid value, output this value
-    stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 0\n"));
+    begin_row(out, "esphome_sensor_failed", labels);
+    end_row(out, 0);
     // Data itself
-    stream->print(F("esphome_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\",unit=\""));
-    stream->print(obj->get_unit_of_measurement().c_str());
-    stream->print(F("\"} "));
-    stream->print(value_accuracy_to_string(obj->state, obj->get_accuracy_decimals()).c_str());
-    stream->print(F("\n"));
+    begin_row(out, "esphome_sensor_value", labels);
+    out.append(",unit=\"");
+    out.append(obj->get_unit_of_measurement());
+    out += '"';
+    end_row(out, obj->state, obj->get_accuracy_decimals());
   } else {
     // Invalid state
-    stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 1\n"));
+    begin_row(out, "esphome_sensor_failed", labels);
+    end_row(out, 1);
   }
 }
 #endif
 
 // Type-specific implementation
 #ifdef USE_BINARY_SENSOR
-void PrometheusHandler::binary_sensor_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_binary_sensor_value gauge\n"));
-  stream->print(F("#TYPE esphome_binary_sensor_failed gauge\n"));
+void PrometheusHandler::binary_sensor_type_(std::string &out) {
+  out.append("#TYPE esphome_binary_sensor_value gauge\n");
+  out.append("#TYPE esphome_binary_sensor_failed gauge\n");
 }
-void PrometheusHandler::binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj) {
+void PrometheusHandler::binary_sensor_row_(std::string &out, binary_sensor::BinarySensor *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
+  const std::string &labels = this->labels_(obj);
   if (obj->has_state()) {
     // We have a valid value, output this value
-    stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 0\n"));
+    begin_row(out, "esphome_binary_sensor_failed", labels);
+    end_row(out, 0);
     // Data itself
-    stream->print(F("esphome_binary_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->state);
-    stream->print(F("\n"));
+    begin_row(out, "esphome_binary_sensor_value", labels);
+    end_row(out, obj->state);
   } else {
     // Invalid state
-    stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 1\n"));
+    begin_row(out, "esphome_binary_sensor_failed", labels);
+    end_row(out, 1);
   }
 }
 #endif
 
 #ifdef USE_FAN
-void PrometheusHandler::fan_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_fan_value gauge\n"));
-  stream->print(F("#TYPE esphome_fan_failed gauge\n"));
-  stream->print(F("#TYPE esphome_fan_speed gauge\n"));
-  stream->print(F("#TYPE esphome_fan_oscillation gauge\n"));
+void PrometheusHandler::fan_type_(std::string &out) {
+  out.append("#TYPE esphome_fan_value gauge\n");
+  out.append("#TYPE esphome_fan_failed gauge\n");
+  out.append("#TYPE esphome_fan_speed gauge\n");
+  out.append("#TYPE esphome_fan_oscillation gauge\n");
 }
-void PrometheusHandler::fan_row_(AsyncResponseStream *stream, fan::Fan *obj) {
+void PrometheusHandler::fan_row_(std::string &out, fan::Fan *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
-  stream->print(F("esphome_fan_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} 0\n"));
+  const std::string &labels = this->labels_(obj);
+  begin_row(out, "esphome_fan_failed", labels);
+  end_row(out, 0);
   // Data itself
-  stream->print(F("esphome_fan_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->state);
-  stream->print(F("\n"));
+  begin_row(out, "esphome_fan_value", labels);
+  end_row(out, obj->state);
   // Speed if available
   if (obj->get_traits().supports_speed()) {
-    stream->print(F("esphome_fan_speed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->speed);
-    stream->print(F("\n"));
+    begin_row(out, "esphome_fan_speed", labels);
+    end_row(out, obj->speed);
   }
   // Oscillation if available
   if (obj->get_traits().supports_oscillation()) {
-    stream->print(F("esphome_fan_oscillation{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->oscillating);
-    stream->print(F("\n"));
+    begin_row(out, "esphome_fan_oscillation", labels);
+    end_row(out, obj->oscillating);
   }
 }
 #endif
 
 #ifdef USE_LIGHT
-void PrometheusHandler::light_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_light_state gauge\n"));
-  stream->print(F("#TYPE esphome_light_color gauge\n"));
-  stream->print(F("#TYPE esphome_light_effect_active gauge\n"));
+void PrometheusHandler::light_type_(std::string &out) {
+  out.append("#TYPE esphome_light_state gauge\n");
+  out.append("#TYPE esphome_light_color gauge\n");
+  out.append("#TYPE esphome_light_effect_active gauge\n");
 }
-void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightState *obj) {
+void PrometheusHandler::light_row_(std::string &out, light::LightState *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
+  const std::string &labels = this->labels_(obj);
   // State
-  stream->print(F("esphome_light_state{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->remote_values.is_on());
-  stream->print(F("\n"));
+  begin_row(out, "esphome_light_state", labels);
+  end_row(out, obj->remote_values.is_on());
   // Brightness and RGBW
   light::LightColorValues color = obj->current_values;
   float brightness, r, g, b, w;
   color.as_brightness(&brightness);
   color.as_rgbw(&r, &g, &b, &w);
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"brightness\"} "));
-  stream->print(brightness);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"r\"} "));
-  stream->print(r);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"g\"} "));
-  stream->print(g);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"b\"} "));
-  stream->print(b);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"w\"} "));
-  stream->print(w);
-  stream->print(F("\n"));
+  begin_row(out, "esphome_light_color", labels);
+  out.append(",channel=\"brightness\"");
+  end_row(out, brightness);
+  begin_row(out, "esphome_light_color", labels);
+  out.append(",channel=\"r\"");
+  end_row(out, r);
+  begin_row(out, "esphome_light_color", labels);
+  out.append(",channel=\"g\"");
+  end_row(out, g);
+  begin_row(out, "esphome_light_color", labels);
+  out.append(",channel=\"b\"");
+  end_row(out, b);
+  begin_row(out, "esphome_light_color", labels);
+  out.append(",channel=\"w\"");
+  end_row(out, w);
   // Effect
   std::string effect = obj->get_effect_name();
+  begin_row(out, "esphome_light_effect_active", labels);
   if (effect == "None") {
-    stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\",effect=\"None\"} 0\n"));
+    out.append(",effect=\"None\"");
+    end_row(out, 0);
   } else {
-    stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\",effect=\""));
-    stream->print(effect.c_str());
-    stream->print(F("\"} 1\n"));
+    out.append(",effect=\"");
+    append_escaped(out, effect);
+    out += '"';
+    end_row(out, 1);
   }
 }
 #endif
 
 #ifdef USE_COVER
-void PrometheusHandler::cover_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_cover_value gauge\n"));
-  stream->print(F("#TYPE esphome_cover_failed gauge\n"));
+void PrometheusHandler::cover_type_(std::string &out) {
+  out.append("#TYPE esphome_cover_value gauge\n");
+  out.append("#TYPE esphome_cover_failed gauge\n");
 }
-void PrometheusHandler::cover_row_(AsyncResponseStream *stream, cover::Cover *obj) {
+void PrometheusHandler::cover_row_(std::string &out, cover::Cover *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
+  const std::string &labels = this->labels_(obj);
   if (!std::isnan(obj->position)) {
     // We have a valid value, output this value
-    stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 0\n"));
+    begin_row(out, "esphome_cover_failed", labels);
+    end_row(out, 0);
     // Data itself
-    stream->print(F("esphome_cover_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->position);
-    stream->print(F("\n"));
+    begin_row(out, "esphome_cover_value", labels);
+    end_row(out, obj->position);
     if (obj->get_traits().get_supports_tilt()) {
-      stream->print(F("esphome_cover_tilt{id=\""));
-      stream->print(relabel_id_(obj).c_str());
-      stream->print(F("\",name=\""));
-      stream->print(relabel_name_(obj).c_str());
-      stream->print(F("\"} "));
-      stream->print(obj->tilt);
-      stream->print(F("\n"));
+      begin_row(out, "esphome_cover_tilt", labels);
+      end_row(out, obj->tilt);
     }
   } else {
     // Invalid state
-    stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 1\n"));
+    begin_row(out, "esphome_cover_failed", labels);
+    end_row(out, 1);
   }
 }
 #endif
 
 #ifdef USE_SWITCH
-void PrometheusHandler::switch_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_switch_value gauge\n"));
-  stream->print(F("#TYPE esphome_switch_failed gauge\n"));
+void PrometheusHandler::switch_type_(std::string &out) {
+  out.append("#TYPE esphome_switch_value gauge\n");
+  out.append("#TYPE esphome_switch_failed gauge\n");
 }
-void PrometheusHandler::switch_row_(AsyncResponseStream *stream, switch_::Switch *obj) {
+void PrometheusHandler::switch_row_(std::string &out, switch_::Switch *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
-  stream->print(F("esphome_switch_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} 0\n"));
+  const std::string &labels = this->labels_(obj);
+  begin_row(out, "esphome_switch_failed", labels);
+  end_row(out, 0);
   // Data itself
-  stream->print(F("esphome_switch_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->state);
-  stream->print(F("\n"));
+  begin_row(out, "esphome_switch_value", labels);
+  end_row(out, obj->state);
 }
 #endif
 
 #ifdef USE_LOCK
-void PrometheusHandler::lock_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_lock_value gauge\n"));
-  stream->print(F("#TYPE esphome_lock_failed gauge\n"));
+void PrometheusHandler::lock_type_(std::string &out) {
+  out.append("#TYPE esphome_lock_value gauge\n");
+  out.append("#TYPE esphome_lock_failed gauge\n");
 }
-void PrometheusHandler::lock_row_(AsyncResponseStream *stream, lock::Lock *obj) {
+void PrometheusHandler::lock_row_(std::string &out, lock::Lock *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
-  stream->print(F("esphome_lock_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} 0\n"));
+  const std::string &labels = this->labels_(obj);
+  begin_row(out, "esphome_lock_failed", labels);
+  end_row(out, 0);
   // Data itself
-  stream->print(F("esphome_lock_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->state);
-  stream->print(F("\n"));
+  begin_row(out, "esphome_lock_value", labels);
+  end_row(out, obj->state);
 }
 #endif
 
@@ -2,6 +2,8 @@
 #include "esphome/core/defines.h"
 #ifdef USE_NETWORK
 #include <map>
+#include <memory>
+#include <string>
 #include <utility>
 
 #include "esphome/components/web_server_base/web_server_base.h"
@@ -48,72 +50,98 @@ class PrometheusHandler : public AsyncWebHandler, public Component {
 
   void handleRequest(AsyncWebServerRequest *req) override;
 
-  void setup() override {
-    this->base_->init();
-    this->base_->add_handler(this);
-  }
+  void setup() override;
   float get_setup_priority() const override {
     // After WiFi
     return setup_priority::WIFI - 1.0f;
   }
 
  protected:
-  std::string relabel_id_(EntityBase *obj);
-  std::string relabel_name_(EntityBase *obj);
+  /// Sections of the exposition, emitted in this order.
+  enum Section : uint8_t {
+    SECTION_SENSOR = 0,
+    SECTION_BINARY_SENSOR,
+    SECTION_FAN,
+    SECTION_LIGHT,
+    SECTION_COVER,
+    SECTION_SWITCH,
+    SECTION_LOCK,
+    SECTION_DONE,
+  };
+
+  /// Position of a single scrape in the exposition. Each request owns one, so concurrent scrapes don't interfere.
+  struct ScrapeState {
+    uint8_t section{SECTION_SENSOR};
+    size_t index{0};
+    /// Rendered rows of the current entity that have not been sent yet
+    std::string pending;
+    size_t pending_pos{0};
+  };
+
+  /// Copy as much of the exposition as fits into buffer, rendering one entity at a time.
+  size_t fill_(ScrapeState &state, uint8_t *buffer, size_t max_len);
+  /// Render the rows of the next entity (and section header) into state.pending. Returns false when done.
+  bool render_next_(ScrapeState &state);
+
+  /// Pre-render the label set of an entity, applying relabeling and escaping.
+  void add_labels_(EntityBase *obj);
+  /// Return the pre-rendered `id="...",name="..."` label set of an entity.
+  const std::string &labels_(EntityBase *obj);
 
 #ifdef USE_SENSOR
   /// Return the type for prometheus
-  void sensor_type_(AsyncResponseStream *stream);
+  void sensor_type_(std::string &out);
   /// Return the sensor state as prometheus data point
-  void sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj);
+  void sensor_row_(std::string &out, sensor::Sensor *obj);
 #endif
 
 #ifdef USE_BINARY_SENSOR
   /// Return the type for prometheus
-  void binary_sensor_type_(AsyncResponseStream *stream);
+  void binary_sensor_type_(std::string &out);
   /// Return the sensor state as prometheus data point
-  void binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj);
+  void binary_sensor_row_(std::string &out, binary_sensor::BinarySensor *obj);
 #endif
 
 #ifdef USE_FAN
   /// Return the type for prometheus
-  void fan_type_(AsyncResponseStream *stream);
+  void fan_type_(std::string &out);
   /// Return the sensor state as prometheus data point
-  void fan_row_(AsyncResponseStream *stream, fan::Fan *obj);
+  void fan_row_(std::string &out, fan::Fan *obj);
 #endif
 
 #ifdef USE_LIGHT
   /// Return the type for prometheus
-  void light_type_(AsyncResponseStream *stream);
+  void light_type_(std::string &out);
   /// Return the Light Values state as prometheus data point
-  void light_row_(AsyncResponseStream *stream, light::LightState *obj);
+  void light_row_(std::string &out, light::LightState *obj);
 #endif
 
 #ifdef USE_COVER
   /// Return the type for prometheus
-  void cover_type_(AsyncResponseStream *stream);
+  void cover_type_(std::string &out);
   /// Return the switch Values state as prometheus data point
-  void cover_row_(AsyncResponseStream *stream, cover::Cover *obj);
+  void cover_row_(std::string &out, cover::Cover *obj);
 #endif
 
 #ifdef USE_SWITCH
   /// Return the type for prometheus
-  void switch_type_(AsyncResponseStream *stream);
+  void switch_type_(std::string &out);
   /// Return the switch Values state as prometheus data point
-  void switch_row_(AsyncResponseStream *stream, switch_::Switch *obj);
+  void switch_row_(std::string &out, switch_::Switch *obj);
 #endif
 
 #ifdef USE_LOCK
   /// Return the type for prometheus
-  void lock_type_(AsyncResponseStream *stream);
+  void lock_type_(std::string &out);
   /// Return the lock Values state as prometheus data point
-  void lock_row_(AsyncResponseStream *stream, lock::Lock *obj);
+  void lock_row_(std::string &out, lock::Lock *obj);
 #endif
 
   web_server_base::WebServerBase *base_;
   bool include_internal_{false};
   std::map<EntityBase *, std::string> relabel_map_id_;
   std::map<EntityBase *, std::string> relabel_map_name_;
+  std::map<EntityBase *, std::string> labels_map_;
 };
 
 }  // namespace prometheus
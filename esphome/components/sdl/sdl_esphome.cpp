@@ -33,13 +33,14 @@ void Sdl::draw_pixels_at(int x_start, int y_start, int w, int h, const uint8_t *
                          display::ColorBitness bitness, bool big_endian, int x_offset, int y_offset, int x_pad) {
   SDL_Rect rect{x_start, y_start, w, h};
   if (this->rotation_ != display::DISPLAY_ROTATION_0_DEGREES || bitness != display::COLOR_BITNESS_565 || big_endian) {
+    // Drawn pixel by pixel, which extends the area that update() presents once, instead of presenting every call
     display::Display::draw_pixels_at(x_start, y_start, w, h, ptr, order, bitness, big_endian, x_offset, y_offset,
                                      x_pad);
-  } else {
-    auto stride = x_offset + w + x_pad;
-    auto data = ptr + (stride * y_offset + x_offset) * 2;
-    SDL_UpdateTexture(this->texture_, &rect, data, stride * 2);
+    return;
   }
+  auto stride = x_offset + w + x_pad;
+  auto data = ptr + (stride * y_offset + x_offset) * 2;
+  SDL_UpdateTexture(this->texture_, &rect, data, stride * 2);
   SDL_RenderCopy(this->renderer_, this->texture_, &rect, &rect);
   SDL_RenderPresent(this->renderer_);
 }
@@ -828,7 +828,10 @@ SENSOR_IN_RANGE_CONDITION_SCHEMA = cv.All(
 
 
 @automation.register_condition(
-    "sensor.in_range", SensorInRangeCondition, SENSOR_IN_RANGE_CONDITION_SCHEMA
+    "sensor.in_range",
+    SensorInRangeCondition,
+    SENSOR_IN_RANGE_CONDITION_SCHEMA,
+    reactive=True,
 )
 async def sensor_in_range_to_code(config, condition_id, template_arg, args):
     paren = await cg.get_variable(config[CONF_ID])
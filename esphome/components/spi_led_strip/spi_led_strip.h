@@ -76,6 +76,7 @@ class SpiLedStrip : public light::AddressableLight,
   }
 
  protected:
+  bool has_flat_buffer_() const override { return true; }
   light::ESPColorView get_view_internal(int32_t index) const override {
     size_t pos = index * 4 + 5;
     return {this->buf_ + pos + 2,       this->buf_ + pos + 1, this->buf_ + pos + 0, nullptr,
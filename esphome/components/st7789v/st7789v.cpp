@@ -118,6 +118,9 @@ void ST7789V::setup() {
 
   this->init_internal_(this->get_buffer_length_());
   memset(this->buffer_, 0x00, this->get_buffer_length_());
+  // the panel was just cleared to match the buffer, only later changes need to be sent
+  this->init_dirty_tiles_();
+  this->clear_dirty_tiles_();
 }
 
 void ST7789V::dump_config() {
@@ -148,11 +151,13 @@ void ST7789V::update() {
 
 void ST7789V::set_model_str(const char *model_str) { this->model_str_ = model_str; }
 
-void ST7789V::write_display_data() {
-  uint16_t x1 = this->offset_height_;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = this->offset_width_;
-  uint16_t y2 = y1 + get_height_internal() - 1;
+void ST7789V::write_display_data() { this->flush_dirty_tiles_(); }
+
+void ST7789V::write_dirty_rect_(int x, int y, int width, int height) {
+  uint16_t x1 = this->offset_height_ + x;
+  uint16_t x2 = x1 + width - 1;
+  uint16_t y1 = this->offset_width_ + y;
+  uint16_t y2 = y1 + height - 1;
 
   this->enable();
 
@@ -174,11 +179,11 @@ void ST7789V::write_display_data() {
   if (this->eightbitcolor_) {
     uint8_t temp_buffer[TEMP_BUFFER_SIZE];
     size_t temp_index = 0;
-    for (int line = 0; line < this->get_buffer_length_(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
-        auto color = display::ColorUtil::color_to_565(
-            display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
-                                         display::ColorBitness::COLOR_BITNESS_332, true));
+    for (int line = y; line < y + height; line++) {
+      const uint8_t *row = this->buffer_ + line * this->get_width_internal() + x;
+      for (int index = 0; index < width; ++index) {
+        auto color = display::ColorUtil::color_to_565(display::ColorUtil::to_color(
+            row[index], display::ColorOrder::COLOR_ORDER_RGB, display::ColorBitness::COLOR_BITNESS_332, true));
         temp_buffer[temp_index++] = (uint8_t) (color >> 8);
         temp_buffer[temp_index++] = (uint8_t) color;
         if (temp_index == TEMP_BUFFER_SIZE) {
@@ -189,8 +194,12 @@ void ST7789V::write_display_data() {
     }
     if (temp_index != 0)
       this->write_array(temp_buffer, temp_index);
+  } else if (width == this->get_width_internal()) {
+    // full rows are contiguous in the buffer
+    this->write_array(this->buffer_ + y * width * 2, width * height * 2);
   } else {
-    this->write_array(this->buffer_, this->get_buffer_length_());
+    for (int line = y; line < y + height; line++)
+      this->write_array(this->buffer_ + (line * this->get_width_internal() + x) * 2, width * 2);
   }
 
   this->disable();
@@ -296,13 +305,18 @@ void HOT ST7789V::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (this->eightbitcolor_) {
     auto color332 = display::ColorUtil::color_to_332(color);
     uint32_t pos = (x + y * this->get_width_internal());
+    if (this->buffer_[pos] == color332)
+      return;
     this->buffer_[pos] = color332;
   } else {
     auto color565 = display::ColorUtil::color_to_565(color);
     uint32_t pos = (x + y * this->get_width_internal()) * 2;
+    if (this->buffer_[pos] == ((color565 >> 8) & 0xff) && this->buffer_[pos + 1] == (color565 & 0xff))
+      return;
     this->buffer_[pos++] = (color565 >> 8) & 0xff;
     this->buffer_[pos] = color565 & 0xff;
   }
+  this->mark_dirty_(x, y, 1, 1);
 }
 
 }  // namespace st7789v
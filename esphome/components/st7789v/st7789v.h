@@ -162,6 +162,7 @@ class ST7789V : public display::DisplayBuffer,
   size_t get_buffer_length_();
 
   void draw_filled_rect_(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);
+  void write_dirty_rect_(int x, int y, int width, int height) override;
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
 
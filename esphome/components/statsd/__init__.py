@@ -13,6 +13,7 @@ AUTO_LOAD = ["socket"]
 CODEOWNERS = ["@Links2004"]
 DEPENDENCIES = ["network"]
 
+CONF_AGGREGATE = "aggregate"
 CONF_HOST = "host"
 CONF_PREFIX = "prefix"
 
@@ -39,6 +40,7 @@ CONFIG_SCHEMA = cv.Schema(
         cv.Required(CONF_HOST): cv.string_strict,
         cv.Optional(CONF_PORT, default=8125): cv.port,
         cv.Optional(CONF_PREFIX, default=""): cv.string_strict,
+        cv.Optional(CONF_AGGREGATE, default=False): cv.boolean,
         cv.Optional(CONF_SENSORS): cv.ensure_list(CONFIG_SENSORS_SCHEMA),
         cv.Optional(CONF_BINARY_SENSORS): cv.ensure_list(CONFIG_BINARY_SENSORS_SCHEMA),
     }
@@ -55,6 +57,7 @@ async def to_code(config):
             config.get(CONF_PREFIX),
         )
     )
+    cg.add(var.set_aggregate(config[CONF_AGGREGATE]))
 
     for sensor_cfg in config.get(CONF_SENSORS, []):
         s = await cg.get_variable(sensor_cfg[CONF_ID])
@@ -1,3 +1,5 @@
+#include <cfloat>
+
 #include "esphome/core/log.h"
 
 #include "statsd.h"
@@ -6,13 +8,47 @@
 namespace esphome {
 namespace statsd {
 
-// send UDP packet if we reach 1Kb packed size
+// pack as many metrics as fit into a single UDP datagram without exceeding the Ethernet MTU
 // this is needed since statsD does not support fragmented UDP packets
-static const uint16_t SEND_THRESHOLD = 1024;
+static const uint16_t MAX_PACKET_SIZE = 1432;
+
+// ":" + sign + all integer digits of the largest double + "." + 6 decimals + "|" + type + "\n" + terminator
+static const size_t MAX_VALUE_SIZE = 2 + (DBL_MAX_10_EXP + 1) + 7 + 3 + 1;
 
 static const char *const TAG = "statsD";
 
 void StatsdComponent::setup() {
+  for (auto &s : this->sensors_) {
+    s.metric.clear();
+    if (this->prefix_) {
+      s.metric.append(this->prefix_);
+      s.metric += '.';
+    }
+    s.metric.append(s.name);
+    s.aggregate = {NAN, NAN, 0, 0};
+  }
+
+  if (this->aggregate_) {
+    // The vector is not modified after setup, so references to its elements stay valid
+    for (auto &s : this->sensors_) {
+      sensors_t *ptr = &s;
+      switch (s.type) {
+#ifdef USE_SENSOR
+        case TYPE_SENSOR:
+          s.sensor->add_on_state_callback([this, ptr](float state) { this->record_(*ptr, state); });
+          break;
+#endif
+#ifdef USE_BINARY_SENSOR
+        case TYPE_BINARY_SENSOR:
+          s.binary_sensor->add_on_state_callback([this, ptr](bool state) { this->record_(*ptr, state ? 1 : 0); });
+          break;
+#endif
+        default:
+          break;
+      }
+    }
+  }
+
 #ifndef USE_ESP8266
   this->sock_ = esphome::socket::socket(AF_INET, SOCK_DGRAM, 0);
 
@@ -44,9 +80,10 @@ void StatsdComponent::dump_config() {
   if (this->prefix_) {
     ESP_LOGCONFIG(TAG, "  prefix: %s", this->prefix_);
   }
+  ESP_LOGCONFIG(TAG, "  aggregate: %s", YESNO(this->aggregate_));
 
   ESP_LOGCONFIG(TAG, "  metrics:");
-  for (sensors_t s : this->sensors_) {
+  for (const sensors_t &s : this->sensors_) {
     ESP_LOGCONFIG(TAG, "    - name: %s", s.name);
     ESP_LOGCONFIG(TAG, "      type: %d", s.type);
   }
@@ -74,11 +111,50 @@ void StatsdComponent::register_binary_sensor(const char *name, esphome::binary_s
 }
 #endif
 
+void StatsdComponent::record_(sensors_t &s, float value) {
+  if (std::isnan(value)) {
+    return;
+  }
+  aggregate_t &agg = s.aggregate;
+  if (agg.count == 0 || value < agg.min) {
+    agg.min = value;
+  }
+  if (agg.count == 0 || value > agg.max) {
+    agg.max = value;
+  }
+  agg.sum += value;
+  agg.count++;
+}
+
 void StatsdComponent::update() {
   std::string out;
-  out.reserve(SEND_THRESHOLD);
+  out.reserve(MAX_PACKET_SIZE);
+
+  for (sensors_t &s : this->sensors_) {
+    if (this->aggregate_) {
+      aggregate_t &agg = s.aggregate;
+      if (agg.count == 0) {
+        continue;
+      }
+      // statsD gauges can't be set to a negative number directly, see below
+      if (agg.min < 0) {
+        this->add_metric_(&out, s.metric, ".min", 0, 'g');
+      }
+      this->add_metric_(&out, s.metric, ".min", agg.min, 'g');
+      if (agg.max < 0) {
+        this->add_metric_(&out, s.metric, ".max", 0, 'g');
+      }
+      this->add_metric_(&out, s.metric, ".max", agg.max, 'g');
+      double avg = agg.sum / agg.count;
+      if (avg < 0) {
+        this->add_metric_(&out, s.metric, "", 0, 'g');
+      }
+      this->add_metric_(&out, s.metric, "", avg, 'g');
+      this->add_metric_(&out, s.metric, ".count", agg.count, 'c');
+      agg = {NAN, NAN, 0, 0};
+      continue;
+    }
 
-  for (sensors_t s : this->sensors_) {
     double val = 0;
     switch (s.type) {
 #ifdef USE_SENSOR
@@ -109,25 +185,33 @@ void StatsdComponent::update() {
     // https://github.com/statsd/statsd/blob/master/docs/metric_types.md
     // This implies you can't explicitly set a gauge to a negative number without first setting it to zero.
     if (val < 0) {
-      if (this->prefix_) {
-        out.append(str_sprintf("%s.", this->prefix_));
-      }
-      out.append(str_sprintf("%s:0|g\n", s.name));
-    }
-    if (this->prefix_) {
-      out.append(str_sprintf("%s.", this->prefix_));
-    }
-    out.append(str_sprintf("%s:%f|g\n", s.name, val));
-
-    if (out.length() > SEND_THRESHOLD) {
-      this->send_(&out);
-      out.clear();
+      this->add_metric_(&out, s.metric, "", 0, 'g');
     }
+    this->add_metric_(&out, s.metric, "", val, 'g');
   }
 
   this->send_(&out);
 }
 
+void StatsdComponent::add_metric_(std::string *out, const std::string &metric, const char *suffix, double value,
+                                  char type) {
+  char buf[MAX_VALUE_SIZE];
+  int len = snprintf(buf, sizeof(buf), ":%f|%c\n", value, type);
+  if (len < 0) {
+    ESP_LOGW(TAG, "Failed to format value of %s%s", metric.c_str(), suffix);
+    return;
+  }
+  size_t line_size = metric.size() + strlen(suffix) + len;
+  // flush before the datagram would exceed the maximum size, a single metric is always sent
+  if (!out->empty() && out->size() + line_size > MAX_PACKET_SIZE) {
+    this->send_(out);
+    out->clear();
+  }
+  out->append(metric);
+  out->append(suffix);
+  out->append(buf, len);
+}
+
 void StatsdComponent::send_(std::string *out) {
   if (out->empty()) {
     return;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <string>
 #include <vector>
 
 #include "esphome/core/defines.h"
@@ -30,9 +31,20 @@ namespace statsd {
 
 using sensor_type_t = enum { TYPE_SENSOR, TYPE_BINARY_SENSOR };
 
-using sensors_t = struct {
+/// Samples collected between two flushes when aggregation is enabled.
+struct aggregate_t {
+  float min;
+  float max;
+  double sum;
+  uint32_t count;
+};
+
+struct sensors_t {
   const char *name;
+  /// Metric name including the prefix, rendered once in setup()
+  std::string metric;
   sensor_type_t type;
+  aggregate_t aggregate;
   union {
 #ifdef USE_SENSOR
     esphome::sensor::Sensor *sensor;
@@ -57,6 +69,8 @@ class StatsdComponent : public PollingComponent {
     this->port_ = port;
     this->prefix_ = prefix;
   }
+  /// Report min/max/avg/count of all states received during an interval instead of the latest state.
+  void set_aggregate(bool aggregate) { this->aggregate_ = aggregate; }
 
 #ifdef USE_SENSOR
   void register_sensor(const char *name, esphome::sensor::Sensor *sensor);
@@ -70,6 +84,7 @@ class StatsdComponent : public PollingComponent {
   const char *host_;
   const char *prefix_;
   uint16_t port_;
+  bool aggregate_{false};
 
   std::vector<sensors_t> sensors_;
 
@@ -80,6 +95,8 @@ class StatsdComponent : public PollingComponent {
   struct sockaddr_in destination_;
 #endif
 
+  void record_(sensors_t &s, float value);
+  void add_metric_(std::string *out, const std::string &metric, const char *suffix, double value, char type);
   void send_(std::string *out);
 };
 
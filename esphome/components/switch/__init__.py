@@ -193,13 +193,17 @@ async def switch_toggle_to_code(config, action_id, template_arg, args):
     return cg.new_Pvariable(action_id, template_arg, paren)
 
 
-@automation.register_condition("switch.is_on", SwitchCondition, SWITCH_ACTION_SCHEMA)
+@automation.register_condition(
+    "switch.is_on", SwitchCondition, SWITCH_ACTION_SCHEMA, reactive=True
+)
 async def switch_is_on_to_code(config, condition_id, template_arg, args):
     paren = await cg.get_variable(config[CONF_ID])
     return cg.new_Pvariable(condition_id, template_arg, paren, True)
 
 
-@automation.register_condition("switch.is_off", SwitchCondition, SWITCH_ACTION_SCHEMA)
+@automation.register_condition(
+    "switch.is_off", SwitchCondition, SWITCH_ACTION_SCHEMA, reactive=True
+)
 async def switch_is_off_to_code(config, condition_id, template_arg, args):
     paren = await cg.get_variable(config[CONF_ID])
     return cg.new_Pvariable(condition_id, template_arg, paren, False)
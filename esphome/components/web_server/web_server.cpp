@@ -12,7 +12,9 @@
 #include "StreamString.h"
 #endif
 
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
 
 #ifdef USE_LIGHT
 #include "esphome/components/light/light_json_schema.h"
@@ -39,6 +41,8 @@ namespace web_server {
 
 static const char *const TAG = "web_server";
 
+static const char *const HEADER_IF_NONE_MATCH = "If-None-Match";
+
 #ifdef USE_WEBSERVER_PRIVATE_NETWORK_ACCESS
 static const char *const HEADER_PNA_NAME = "Private-Network-Access-Name";
 static const char *const HEADER_PNA_ID = "Private-Network-Access-ID";
@@ -46,29 +50,33 @@ static const char *const HEADER_CORS_REQ_PNA = "Access-Control-Request-Private-N
 static const char *const HEADER_CORS_ALLOW_PNA = "Access-Control-Allow-Private-Network";
 #endif
 
-UrlMatch match_url(const std::string &url, bool only_domain = false) {
+UrlMatch match_url(const char *url, size_t url_len, bool only_domain = false) {
   UrlMatch match;
   match.valid = false;
-  size_t domain_end = url.find('/', 1);
-  if (domain_end == std::string::npos)
+  match.key = 0;
+  if (url_len == 0)
+    return match;
+  const char *url_end = url + url_len;
+  const char *domain_end = static_cast<const char *>(memchr(url + 1, '/', url_len - 1));
+  if (domain_end == nullptr)
     return match;
-  match.domain = url.substr(1, domain_end - 1);
+  match.domain = StringRef(url + 1, domain_end - url - 1);
   if (only_domain) {
     match.valid = true;
     return match;
   }
-  if (url.length() == domain_end - 1)
-    return match;
-  size_t id_begin = domain_end + 1;
-  size_t id_end = url.find('/', id_begin);
+  const char *id_begin = domain_end + 1;
+  const char *id_end = static_cast<const char *>(memchr(id_begin, '/', url_end - id_begin));
   match.valid = true;
-  if (id_end == std::string::npos) {
-    match.id = url.substr(id_begin, url.length() - id_begin);
-    return match;
+  if (id_end == nullptr) {
+    match.id = StringRef(id_begin, url_end - id_begin);
+    id_end = url_end;
+  } else {
+    match.id = StringRef(id_begin, id_end - id_begin);
+    match.method = StringRef(id_end + 1, url_end - id_end - 1);
   }
-  match.id = url.substr(id_begin, id_end - id_begin);
-  size_t method_begin = id_end + 1;
-  match.method = url.substr(method_begin, url.length() - method_begin);
+  // "<domain>/<id>" is contiguous in the URL, hash it in place
+  match.key = fnv1_hash(url + 1, id_end - url - 1);
   return match;
 }
 
@@ -99,6 +107,92 @@ std::string WebServer::get_config_json() {
 void WebServer::setup() {
   ESP_LOGCONFIG(TAG, "Setting up web server...");
   this->setup_controller(this->include_internal_);
+  // Static assets are baked into the firmware, so they only change when the firmware is rebuilt
+  this->etag_ = "\"" + format_hex(fnv1_hash(App.get_compilation_time())) + "\"";
+
+  // Resolve REST URLs with a binary search instead of comparing object ids of every entity in the domain
+#ifdef USE_SENSOR
+  for (auto *obj : App.get_sensors())
+    this->add_route_("sensor", obj);
+#endif
+#ifdef USE_SWITCH
+  for (auto *obj : App.get_switches())
+    this->add_route_("switch", obj);
+#endif
+#ifdef USE_BUTTON
+  for (auto *obj : App.get_buttons())
+    this->add_route_("button", obj);
+#endif
+#ifdef USE_BINARY_SENSOR
+  for (auto *obj : App.get_binary_sensors())
+    this->add_route_("binary_sensor", obj);
+#endif
+#ifdef USE_FAN
+  for (auto *obj : App.get_fans())
+    this->add_route_("fan", obj);
+#endif
+#ifdef USE_LIGHT
+  for (auto *obj : App.get_lights())
+    this->add_route_("light", obj);
+#endif
+#ifdef USE_TEXT_SENSOR
+  for (auto *obj : App.get_text_sensors())
+    this->add_route_("text_sensor", obj);
+#endif
+#ifdef USE_COVER
+  for (auto *obj : App.get_covers())
+    this->add_route_("cover", obj);
+#endif
+#ifdef USE_NUMBER
+  for (auto *obj : App.get_numbers())
+    this->add_route_("number", obj);
+#endif
+#ifdef USE_DATETIME_DATE
+  for (auto *obj : App.get_dates())
+    this->add_route_("date", obj);
+#endif
+#ifdef USE_DATETIME_TIME
+  for (auto *obj : App.get_times())
+    this->add_route_("time", obj);
+#endif
+#ifdef USE_DATETIME_DATETIME
+  for (auto *obj : App.get_datetimes())
+    this->add_route_("datetime", obj);
+#endif
+#ifdef USE_TEXT
+  for (auto *obj : App.get_texts())
+    this->add_route_("text", obj);
+#endif
+#ifdef USE_SELECT
+  for (auto *obj : App.get_selects())
+    this->add_route_("select", obj);
+#endif
+#ifdef USE_CLIMATE
+  for (auto *obj : App.get_climates())
+    this->add_route_("climate", obj);
+#endif
+#ifdef USE_LOCK
+  for (auto *obj : App.get_locks())
+    this->add_route_("lock", obj);
+#endif
+#ifdef USE_VALVE
+  for (auto *obj : App.get_valves())
+    this->add_route_("valve", obj);
+#endif
+#ifdef USE_ALARM_CONTROL_PANEL
+  for (auto *obj : App.get_alarm_control_panels())
+    this->add_route_("alarm_control_panel", obj);
+#endif
+#ifdef USE_EVENT
+  for (auto *obj : App.get_events())
+    this->add_route_("event", obj);
+#endif
+#ifdef USE_UPDATE
+  for (auto *obj : App.get_updates())
+    this->add_route_("update", obj);
+#endif
+  std::sort(this->routes_.begin(), this->routes_.end(), [](const Route &a, const Route &b) { return a.key < b.key; });
+
   this->base_->init();
 
   this->events_.onConnect([this](AsyncEventSourceClient *client) {
@@ -155,17 +249,45 @@ void WebServer::dump_config() {
 }
 float WebServer::get_setup_priority() const { return setup_priority::WIFI - 1.0f; }
 
+bool WebServer::handle_not_modified_(AsyncWebServerRequest *request) {
+#ifdef USE_ARDUINO
+  AsyncWebHeader *header = request->getHeader(HEADER_IF_NONE_MATCH);
+  if (header == nullptr || header->value().indexOf(this->etag_.c_str()) < 0)
+    return false;
+#else
+  auto header = request->get_header(HEADER_IF_NONE_MATCH);
+  if (!header.has_value() || header->find(this->etag_) == std::string::npos)
+    return false;
+#endif
+  AsyncWebServerResponse *response = request->beginResponse(304, "");
+  this->add_cache_headers_(response);
+  request->send(response);
+  return true;
+}
+
+void WebServer::add_cache_headers_(AsyncWebServerResponse *response) {
+  response->addHeader("ETag", this->etag_.c_str());
+  // Let browsers keep the asset, but revalidate it on every load so a new firmware is picked up immediately
+  response->addHeader("Cache-Control", "no-cache");
+}
+
 #ifdef USE_WEBSERVER_LOCAL
 void WebServer::handle_index_request(AsyncWebServerRequest *request) {
+  if (this->handle_not_modified_(request))
+    return;
   AsyncWebServerResponse *response = request->beginResponse_P(200, "text/html", INDEX_GZ, sizeof(INDEX_GZ));
   response->addHeader("Content-Encoding", "gzip");
+  this->add_cache_headers_(response);
   request->send(response);
 }
 #elif USE_WEBSERVER_VERSION >= 2
 void WebServer::handle_index_request(AsyncWebServerRequest *request) {
+  if (this->handle_not_modified_(request))
+    return;
   AsyncWebServerResponse *response =
       request->beginResponse_P(200, "text/html", ESPHOME_WEBSERVER_INDEX_HTML, ESPHOME_WEBSERVER_INDEX_HTML_SIZE);
   // No gzip header here because the HTML file is so small
+  this->add_cache_headers_(response);
   request->send(response);
 }
 #endif
@@ -183,18 +305,24 @@ void WebServer::handle_pna_cors_request(AsyncWebServerRequest *request) {
 
 #ifdef USE_WEBSERVER_CSS_INCLUDE
 void WebServer::handle_css_request(AsyncWebServerRequest *request) {
+  if (this->handle_not_modified_(request))
+    return;
   AsyncWebServerResponse *response =
       request->beginResponse_P(200, "text/css", ESPHOME_WEBSERVER_CSS_INCLUDE, ESPHOME_WEBSERVER_CSS_INCLUDE_SIZE);
   response->addHeader("Content-Encoding", "gzip");
+  this->add_cache_headers_(response);
   request->send(response);
 }
 #endif
 
 #ifdef USE_WEBSERVER_JS_INCLUDE
 void WebServer::handle_js_request(AsyncWebServerRequest *request) {
+  if (this->handle_not_modified_(request))
+    return;
   AsyncWebServerResponse *response =
       request->beginResponse_P(200, "text/javascript", ESPHOME_WEBSERVER_JS_INCLUDE, ESPHOME_WEBSERVER_JS_INCLUDE_SIZE);
   response->addHeader("Content-Encoding", "gzip");
+  this->add_cache_headers_(response);
   request->send(response);
 }
 #endif
@@ -224,9 +352,8 @@ void WebServer::on_sensor_update(sensor::Sensor *obj, float state) {
   this->events_.send(this->sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (sensor::Sensor *obj : App.get_sensors()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  auto *obj = static_cast<sensor::Sensor *>(this->find_entity_(match));
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
@@ -272,9 +399,8 @@ void WebServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::s
   this->events_.send(this->text_sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_text_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (text_sensor::TextSensor *obj : App.get_text_sensors()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  auto *obj = static_cast<text_sensor::TextSensor *>(this->find_entity_(match));
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
@@ -311,10 +437,8 @@ void WebServer::on_switch_update(switch_::Switch *obj, bool state) {
   this->events_.send(this->switch_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (switch_::Switch *obj : App.get_switches()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  auto *obj = static_cast<switch_::Switch *>(this->find_entity_(match));
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
@@ -357,9 +481,8 @@ std::string WebServer::switch_json(switch_::Switch *obj, bool value, JsonDetail
 
 #ifdef USE_BUTTON
 void WebServer::handle_button_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (button::Button *obj : App.get_buttons()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  auto *obj = static_cast<button::Button *>(this->find_entity_(match));
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
@@ -401,9 +524,8 @@ void WebServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool s
   this->events_.send(this->binary_sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (binary_sensor::BinarySensor *obj : App.get_binary_sensors()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  auto *obj = static_cast<binary_sensor::BinarySensor *>(this->find_entity_(match));
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
@@ -440,10 +562,8 @@ void WebServer::on_fan_update(fan::Fan *obj) {
   this->events_.send(this->fan_json(obj, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_fan_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (fan::Fan *obj : App.get_fans()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  auto *obj = static_cast<fan::Fan *>(this->find_entity_(match));
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
@@ -526,10 +646,8 @@ void WebServer::on_light_update(light::LightState *obj) {
   this->events_.send(this->light_json(obj, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_light_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (light::LightState *obj : App.get_lights()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  auto *obj = static_cast<light::LightState *>(this->find_entity_(match));
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
@@ -645,10 +763,8 @@ void WebServer::on_cover_update(cover::Cover *obj) {
   this->events_.send(this->cover_json(obj, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_cover_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (cover::Cover *obj : App.get_covers()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  auto *obj = static_cast<cover::Cover *>(this->find_entity_(match));
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
@@ -729,10 +845,8 @@ void WebServer::on_number_update(number::Number *obj, float state) {
   this->events_.send(this->number_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_number_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_numbers()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  auto *obj = static_cast<number::Number *>(this->find_entity_(match));
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
@@ -803,9 +917,8 @@ void WebServer::on_date_update(datetime::DateEntity *obj) {
   this->events_.send(this->date_json(obj, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_date_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_dates()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  auto *obj = static_cast<datetime::DateEntity *>(this->find_entity_(match));
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
@@ -865,9 +978,8 @@ void WebServer::on_time_update(datetime::TimeEntity *obj) {
   this->events_.send(this->time_json(obj, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_time_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_times()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  auto *obj = static_cast<datetime::TimeEntity *>(this->find_entity_(match));
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
@@ -926,9 +1038,8 @@ void WebServer::on_datetime_update(datetime::DateTimeEntity *obj) {
   this->events_.send(this->datetime_json(obj, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_datetime_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_datetimes()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  auto *obj = static_cast<datetime::DateTimeEntity *>(this->find_entity_(match));
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
@@ -988,10 +1099,8 @@ void WebServer::on_text_update(text::Text *obj, const std::string &state) {
   this->events_.send(this->text_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_text_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_texts()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  auto *obj = static_cast<text::Text *>(this->find_entity_(match));
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
@@ -1052,10 +1161,8 @@ void WebServer::on_select_update(select::Select *obj, const std::string &state,
   this->events_.send(this->select_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_select_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_selects()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  auto *obj = static_cast<select::Select *>(this->find_entity_(match));
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
@@ -1114,10 +1221,8 @@ void WebServer::on_climate_update(climate::Climate *obj) {
   this->events_.send(this->climate_json(obj, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_climate_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_climates()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  auto *obj = static_cast<climate::Climate *>(this->find_entity_(match));
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
@@ -1275,10 +1380,8 @@ void WebServer::on_lock_update(lock::Lock *obj) {
   this->events_.send(this->lock_json(obj, obj->state, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_lock_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (lock::Lock *obj : App.get_locks()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  auto *obj = static_cast<lock::Lock *>(this->find_entity_(match));
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
@@ -1326,10 +1429,8 @@ void WebServer::on_valve_update(valve::Valve *obj) {
   this->events_.send(this->valve_json(obj, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_valve_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (valve::Valve *obj : App.get_valves()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  auto *obj = static_cast<valve::Valve *>(this->find_entity_(match));
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
@@ -1401,10 +1502,8 @@ void WebServer::on_alarm_control_panel_update(alarm_control_panel::AlarmControlP
   this->events_.send(this->alarm_control_panel_json(obj, obj->get_state(), DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_alarm_control_panel_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (alarm_control_panel::AlarmControlPanel *obj : App.get_alarm_control_panels()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  auto *obj = static_cast<alarm_control_panel::AlarmControlPanel *>(this->find_entity_(match));
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
@@ -1442,10 +1541,8 @@ void WebServer::on_event(event::Event *obj, const std::string &event_type) {
   this->events_.send(this->event_json(obj, event_type, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_event_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (event::Event *obj : App.get_events()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  auto *obj = static_cast<event::Event *>(this->find_entity_(match));
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
@@ -1489,10 +1586,8 @@ void WebServer::on_update(update::UpdateEntity *obj) {
   this->events_.send(this->update_json(obj, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_update_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (update::UpdateEntity *obj : App.get_updates()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  auto *obj = static_cast<update::UpdateEntity *>(this->find_entity_(match));
+  if (obj != nullptr) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
@@ -1550,18 +1645,20 @@ std::string WebServer::update_json(update::UpdateEntity *obj, JsonDetail start_c
 #endif
 
 bool WebServer::canHandle(AsyncWebServerRequest *request) {
-  if (request->url() == "/")
-    return true;
-
+  bool static_asset = request->url() == "/";
 #ifdef USE_WEBSERVER_CSS_INCLUDE
-  if (request->url() == "/0.css")
-    return true;
+  static_asset |= request->url() == "/0.css";
 #endif
-
 #ifdef USE_WEBSERVER_JS_INCLUDE
-  if (request->url() == "/0.js")
-    return true;
+  static_asset |= request->url() == "/0.js";
 #endif
+  if (static_asset) {
+#ifdef USE_ARDUINO
+    // Keep the header around so conditional requests can be answered with 304 Not Modified.
+    request->addInterestingHeader(HEADER_IF_NONE_MATCH);
+#endif
+    return true;
+  }
 
 #ifdef USE_WEBSERVER_PRIVATE_NETWORK_ACCESS
   if (request->method() == HTTP_OPTIONS && request->hasHeader(HEADER_CORS_REQ_PNA)) {
@@ -1575,7 +1672,8 @@ bool WebServer::canHandle(AsyncWebServerRequest *request) {
   }
 #endif
 
-  UrlMatch match = match_url(request->url().c_str(), true);
+  const auto &url = request->url();
+  UrlMatch match = match_url(url.c_str(), url.length(), true);
   if (!match.valid)
     return false;
 #ifdef USE_SENSOR
@@ -1707,7 +1805,8 @@ void WebServer::handleRequest(AsyncWebServerRequest *request) {
   }
 #endif
 
-  UrlMatch match = match_url(request->url().c_str());
+  const auto &url = request->url();
+  UrlMatch match = match_url(url.c_str(), url.length());
 #ifdef USE_SENSOR
   if (match.domain == "sensor") {
     this->handle_sensor_request(request, match);
@@ -1836,6 +1935,13 @@ void WebServer::handleRequest(AsyncWebServerRequest *request) {
   }
 #endif
 
+#ifdef USE_EVENT
+  if (match.domain == "event") {
+    this->handle_event_request(request, match);
+    return;
+  }
+#endif
+
 #ifdef USE_UPDATE
   if (match.domain == "update") {
     this->handle_update_request(request, match);
@@ -1854,6 +1960,25 @@ void WebServer::add_sorting_group(uint64_t group_id, const std::string &group_na
   this->sorting_groups_[group_id] = SortingGroup{group_name, weight};
 }
 
+void WebServer::add_route_(const char *domain, EntityBase *entity) {
+  std::string object_id = entity->get_object_id();
+  std::string path = domain;
+  path += '/';
+  path += object_id;
+  this->routes_.push_back(Route{fnv1_hash(path), domain, std::move(object_id), entity});
+}
+
+EntityBase *WebServer::find_entity_(const UrlMatch &match) const {
+  auto it = std::lower_bound(this->routes_.begin(), this->routes_.end(), match.key,
+                             [](const Route &route, uint32_t key) { return route.key < key; });
+  for (; it != this->routes_.end() && it->key == match.key; ++it) {
+    // The hash only narrows the search, the full URL must match so a collision can't resolve to another entity
+    if (match.domain == it->domain && match.id == it->object_id)
+      return it->entity;
+  }
+  return nullptr;
+}
+
 void WebServer::schedule_(std::function<void()> &&f) {
 #ifdef USE_ESP32
   xSemaphoreTake(this->to_schedule_lock_, portMAX_DELAY);
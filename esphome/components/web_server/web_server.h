@@ -7,6 +7,7 @@
 #include "esphome/core/component.h"
 #include "esphome/core/controller.h"
 #include "esphome/core/entity_base.h"
+#include "esphome/core/string_ref.h"
 
 #include <map>
 #include <vector>
@@ -35,11 +36,21 @@ namespace esphome {
 namespace web_server {
 
 /// Internal helper struct that is used to parse incoming URLs
+/// The members point into the request URL, so a match must not outlive the URL it was created from.
 struct UrlMatch {
-  std::string domain;  ///< The domain of the component, for example "sensor"
-  std::string id;      ///< The id of the device that's being accessed, for example "living_room_fan"
-  std::string method;  ///< The method that's being called, for example "turn_on"
-  bool valid;          ///< Whether this match is valid
+  StringRef domain;  ///< The domain of the component, for example "sensor"
+  StringRef id;      ///< The id of the device that's being accessed, for example "living_room_fan"
+  StringRef method;  ///< The method that's being called, for example "turn_on"
+  uint32_t key;      ///< FNV-1 hash of "<domain>/<id>", used to look up the entity in the route table
+  bool valid;        ///< Whether this match is valid
+};
+
+/// Entry of the route table mapping a "<domain>/<id>" URL to its entity.
+struct Route {
+  uint32_t key;           ///< FNV-1 hash of "<domain>/<object_id>"
+  const char *domain;     ///< Domain of the entity, compared together with its object id on lookup
+  std::string object_id;  ///< Object id of the entity, built once so lookups don't allocate
+  EntityBase *entity;
 };
 
 struct SortingComponents {
@@ -351,12 +362,24 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
 
  protected:
   void schedule_(std::function<void()> &&f);
+  /// Answer with 304 Not Modified if the client already has the current version of a static asset.
+  bool handle_not_modified_(AsyncWebServerRequest *request);
+  /// Add the ETag and Cache-Control headers of static assets.
+  void add_cache_headers_(AsyncWebServerResponse *response);
+  /// Add the REST route of an entity to the route table.
+  void add_route_(const char *domain, EntityBase *entity);
+  /// Look up the entity a parsed URL refers to, nullptr if there is none.
+  EntityBase *find_entity_(const UrlMatch &match) const;
   friend ListEntitiesIterator;
   web_server_base::WebServerBase *base_;
   AsyncEventSource events_{"/events"};
   ListEntitiesIterator entities_iterator_;
   std::map<EntityBase *, SortingComponents> sorting_entitys_;
   std::map<uint64_t, SortingGroup> sorting_groups_;
+  /// All REST routes sorted by key, built once in setup()
+  std::vector<Route> routes_;
+  /// ETag of the static assets, derived from the firmware build
+  std::string etag_;
 
 #if USE_WEBSERVER_VERSION == 1
   const char *css_url_{nullptr};
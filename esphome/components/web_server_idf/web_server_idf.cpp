@@ -13,6 +13,10 @@
 namespace esphome {
 namespace web_server_idf {
 
+#ifndef HTTPD_304
+#define HTTPD_304 "304 Not Modified"
+#endif
+
 #ifndef HTTPD_409
 #define HTTPD_409 "409 Conflict"
 #endif
@@ -20,6 +24,8 @@ namespace web_server_idf {
 #define CRLF_STR "\r\n"
 #define CRLF_LEN (sizeof(CRLF_STR) - 1)
 
+static const size_t CHUNKED_RESPONSE_BUFFER_SIZE = 1024;
+
 static const char *const TAG = "web_server_idf";
 
 void AsyncWebServer::end() {
@@ -35,6 +41,9 @@ void AsyncWebServer::begin() {
   }
   httpd_config_t config = HTTPD_DEFAULT_CONFIG();
   config.server_port = this->port_;
+  // Connections are kept alive between requests; when all sockets are in use, close the least recently used one
+  // instead of refusing new clients.
+  config.lru_purge_enable = true;
   config.uri_match_fn = [](const char * /*unused*/, const char * /*unused*/, size_t /*unused*/) { return true; };
   if (httpd_start(&this->server_, &config) == ESP_OK) {
     const httpd_uri_t handler_get = {
@@ -121,7 +130,9 @@ esp_err_t AsyncWebServer::request_handler_(AsyncWebServerRequest *request) const
     this->on_not_found_(request);
     return ESP_OK;
   }
-  return ESP_ERR_NOT_FOUND;
+  // Answer instead of returning an error, which would make the server drop the (keep-alive) connection
+  httpd_resp_send_err(*request, HTTPD_404_NOT_FOUND, nullptr);
+  return ESP_OK;
 }
 
 AsyncWebServerRequest::~AsyncWebServerRequest() {
@@ -147,9 +158,7 @@ std::string AsyncWebServerRequest::url() const {
 
 std::string AsyncWebServerRequest::host() const { return this->get_header("Host").value(); }
 
-void AsyncWebServerRequest::send(AsyncWebServerResponse *response) {
-  httpd_resp_send(*this, response->get_content_data(), response->get_content_size());
-}
+void AsyncWebServerRequest::send(AsyncWebServerResponse *response) { response->send_content(*this); }
 
 void AsyncWebServerRequest::send(int code, const char *content_type, const char *content) {
   this->init_response_(nullptr, code, content_type);
@@ -168,6 +177,7 @@ void AsyncWebServerRequest::redirect(const std::string &url) {
 
 void AsyncWebServerRequest::init_response_(AsyncWebServerResponse *rsp, int code, const char *content_type) {
   httpd_resp_set_status(*this, code == 200   ? HTTPD_200
+                               : code == 304 ? HTTPD_304
                                : code == 404 ? HTTPD_404
                                : code == 409 ? HTTPD_409
                                              : to_string(code).c_str());
@@ -250,6 +260,56 @@ void AsyncWebServerResponse::addHeader(const char *name, const char *value) {
   httpd_resp_set_hdr(*this->req_, name, value);
 }
 
+esp_err_t AsyncWebServerResponseChunked::send_content(httpd_req_t *req) {
+  auto buffer = std::unique_ptr<uint8_t[]>(new uint8_t[CHUNKED_RESPONSE_BUFFER_SIZE]);
+  size_t index = 0;
+  while (true) {
+    const size_t len = this->filler_(buffer.get(), CHUNKED_RESPONSE_BUFFER_SIZE, index);
+    if (len == 0) {
+      break;
+    }
+    const esp_err_t err = httpd_resp_send_chunk(req, reinterpret_cast<const char *>(buffer.get()), len);
+    if (err != ESP_OK) {
+      return err;
+    }
+    index += len;
+  }
+  // An empty chunk terminates the response
+  return httpd_resp_send_chunk(req, nullptr, 0);
+}
+
+void AsyncResponseStream::flush_if_full_() {
+  if (this->error_ != ESP_OK) {
+    // The client is gone, drop the output instead of buffering the rest of the response
+    this->content_.clear();
+    return;
+  }
+  if (this->content_.size() < CHUNKED_RESPONSE_BUFFER_SIZE) {
+    return;
+  }
+  this->error_ = httpd_resp_send_chunk(*this->req_, this->content_.data(), this->content_.size());
+  this->content_.clear();
+  this->chunked_ = true;
+}
+
+esp_err_t AsyncResponseStream::send_content(httpd_req_t *req) {
+  if (!this->chunked_) {
+    return AsyncWebServerResponse::send_content(req);
+  }
+  if (this->error_ != ESP_OK) {
+    return this->error_;
+  }
+  if (!this->content_.empty()) {
+    const esp_err_t err = httpd_resp_send_chunk(req, this->content_.data(), this->content_.size());
+    this->content_.clear();
+    if (err != ESP_OK) {
+      return err;
+    }
+  }
+  // An empty chunk terminates the response
+  return httpd_resp_send_chunk(req, nullptr, 0);
+}
+
 void AsyncResponseStream::print(float value) { this->print(to_string(value)); }
 
 void AsyncResponseStream::printf(const char *fmt, ...) {
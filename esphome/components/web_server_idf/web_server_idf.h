@@ -18,6 +18,9 @@ namespace web_server_idf {
 
 using String = std::string;
 
+/// Callback filling the next part of a chunked response body; returning 0 ends the response.
+using AwsResponseFiller = std::function<size_t(uint8_t *buffer, size_t max_len, size_t index)>;
+
 class AsyncWebParameter {
  public:
   AsyncWebParameter(std::string value) : value_(std::move(value)) {}
@@ -40,6 +43,11 @@ class AsyncWebServerResponse {
   virtual const char *get_content_data() const = 0;
   virtual size_t get_content_size() const = 0;
 
+  /// Send the response body. Responses that don't hold their body in memory override this.
+  virtual esp_err_t send_content(httpd_req_t *req) {
+    return httpd_resp_send(req, this->get_content_data(), this->get_content_size());
+  }
+
  protected:
   const AsyncWebServerRequest *req_;
 };
@@ -64,6 +72,12 @@ class AsyncWebServerResponseContent : public AsyncWebServerResponse {
   std::string content_;
 };
 
+/** Response that is built by printing to it.
+ *
+ * Small responses are sent in one piece with a Content-Length. Once the buffered content grows beyond a chunk, it is
+ * sent with chunked transfer encoding while printing, so large responses are never held in memory as a whole. All
+ * headers must therefore be added before printing.
+ */
 class AsyncResponseStream : public AsyncWebServerResponse {
  public:
   AsyncResponseStream(const AsyncWebServerRequest *req) : AsyncWebServerResponse(req) {}
@@ -71,13 +85,26 @@ class AsyncResponseStream : public AsyncWebServerResponse {
   const char *get_content_data() const override { return this->content_.c_str(); };
   size_t get_content_size() const override { return this->content_.size(); };
 
-  void print(const char *str) { this->content_.append(str); }
-  void print(const std::string &str) { this->content_.append(str); }
+  esp_err_t send_content(httpd_req_t *req) override;
+
+  void print(const char *str) {
+    this->content_.append(str);
+    this->flush_if_full_();
+  }
+  void print(const std::string &str) {
+    this->content_.append(str);
+    this->flush_if_full_();
+  }
   void print(float value);
   void printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
 
  protected:
+  void flush_if_full_();
+
   std::string content_;
+  bool chunked_{false};
+  /// Result of the first failed chunk, nothing is sent anymore once this is set.
+  esp_err_t error_{ESP_OK};
 };
 
 class AsyncWebServerResponseProgmem : public AsyncWebServerResponse {
@@ -93,6 +120,20 @@ class AsyncWebServerResponseProgmem : public AsyncWebServerResponse {
   size_t size_;
 };
 
+class AsyncWebServerResponseChunked : public AsyncWebServerResponse {
+ public:
+  AsyncWebServerResponseChunked(const AsyncWebServerRequest *req, AwsResponseFiller filler)
+      : AsyncWebServerResponse(req), filler_(std::move(filler)) {}
+
+  const char *get_content_data() const override { return nullptr; };
+  size_t get_content_size() const override { return 0; };
+
+  esp_err_t send_content(httpd_req_t *req) override;
+
+ protected:
+  AwsResponseFiller filler_;
+};
+
 class AsyncWebServerRequest {
   friend class AsyncWebServer;
 
@@ -133,6 +174,12 @@ class AsyncWebServerRequest {
     return res;
   }
   // NOLINTNEXTLINE(readability-identifier-naming)
+  AsyncWebServerResponse *beginChunkedResponse(const char *content_type, AwsResponseFiller filler) {
+    auto *res = new AsyncWebServerResponseChunked(this, std::move(filler));  // NOLINT(cppcoreguidelines-owning-memory)
+    this->init_response_(res, 200, content_type);
+    return res;
+  }
+  // NOLINTNEXTLINE(readability-identifier-naming)
   AsyncResponseStream *beginResponseStream(const char *content_type) {
     auto *res = new AsyncResponseStream(this);  // NOLINT(cppcoreguidelines-owning-memory)
     this->init_response_(res, 200, content_type);
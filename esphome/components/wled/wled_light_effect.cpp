@@ -193,12 +193,9 @@ bool WLEDLightEffect::parse_warls_frame_(light::AddressableLight &it, const uint
 
   for (; count > 0; count--, payload += 4) {
     uint8_t led = payload[0];
-    uint8_t r = payload[1];
-    uint8_t g = payload[2];
-    uint8_t b = payload[3];
 
     if (led < max_leds) {
-      it[led].set(Color(r, g, b));
+      it.write_pixels(led, 1, payload + 1, light::PIXEL_FORMAT_RGB);
     }
   }
 
@@ -211,18 +208,7 @@ bool WLEDLightEffect::parse_drgb_frame_(light::AddressableLight &it, const uint8
     return false;
   }
 
-  auto count = size / 3;
-  auto max_leds = it.size();
-
-  for (uint16_t led = 0; led < count; ++led, payload += 3) {
-    uint8_t r = payload[0];
-    uint8_t g = payload[1];
-    uint8_t b = payload[2];
-
-    if (led < max_leds) {
-      it[led].set(Color(r, g, b));
-    }
-  }
+  it.write_pixels(0, size / 3, payload, light::PIXEL_FORMAT_RGB);
 
   return true;
 }
@@ -233,19 +219,7 @@ bool WLEDLightEffect::parse_drgbw_frame_(light::AddressableLight &it, const uint
     return false;
   }
 
-  auto count = size / 4;
-  auto max_leds = it.size();
-
-  for (uint16_t led = 0; led < count; ++led, payload += 4) {
-    uint8_t r = payload[0];
-    uint8_t g = payload[1];
-    uint8_t b = payload[2];
-    uint8_t w = payload[3];
-
-    if (led < max_leds) {
-      it[led].set(Color(r, g, b, w));
-    }
-  }
+  it.write_pixels(0, size / 4, payload, light::PIXEL_FORMAT_RGBW);
 
   return true;
 }
@@ -265,18 +239,7 @@ bool WLEDLightEffect::parse_dnrgb_frame_(light::AddressableLight &it, const uint
     return false;
   }
 
-  auto count = size / 3;
-  auto max_leds = it.size();
-
-  for (; count > 0; count--, payload += 3, led++) {
-    uint8_t r = payload[0];
-    uint8_t g = payload[1];
-    uint8_t b = payload[2];
-
-    if (led < max_leds) {
-      it[led].set(Color(r, g, b));
-    }
-  }
+  it.write_pixels(led, size / 3, payload, light::PIXEL_FORMAT_RGB);
 
   return true;
 }
@@ -5,6 +5,7 @@
 #include "esphome/core/defines.h"
 #include "esphome/core/preferences.h"
 
+#include <algorithm>
 #include <vector>
 
 namespace esphome {
@@ -101,6 +102,58 @@ template<typename... Ts> class ForCondition : public Condition<Ts...>, public Co
   uint32_t last_inactive_{0};
 };
 
+/// A `for:` condition whose inner condition only reads entity states. Instead of polling from loop(), it's re-checked
+/// from the state callbacks of those entities, with a timeout for the moment the time has passed.
+template<typename... Ts> class ReactiveForCondition : public Condition<Ts...>, public Component {
+ public:
+  explicit ReactiveForCondition(Condition<> *condition) : condition_(condition) {}
+
+  void set_time(uint32_t time) { this->time_ = time; }
+  /// Re-check the inner condition whenever the state of `entity` changes.
+  template<typename T> void watch(T *entity) {
+    entity->add_on_state_callback([this](auto &&...) { this->on_change_(); });
+  }
+  /// Called when the result of check() may have changed.
+  void add_on_state_callback(std::function<void()> &&callback) { this->state_callback_.add(std::move(callback)); }
+
+  void setup() override {
+    // An entity that published during an earlier setup already started the time
+    if (this->active_)
+      return;
+    // Like the polling version, a condition that is active from boot counts from time 0
+    if (!this->condition_->check())
+      return;
+    this->active_ = true;
+    uint32_t now = millis();
+    if (now < this->time_)
+      this->set_timeout("for", this->time_ - now, [this]() { this->state_callback_.call(); });
+  }
+  float get_setup_priority() const override { return setup_priority::DATA; }
+
+  bool check(Ts... x) override { return this->active_ && millis() - this->last_inactive_ >= this->time_; }
+
+ protected:
+  void on_change_() {
+    bool cond = this->condition_->check();
+    if (cond == this->active_)
+      return;
+    this->active_ = cond;
+    if (cond) {
+      this->last_inactive_ = millis();
+      this->set_timeout("for", this->time_, [this]() { this->state_callback_.call(); });
+    } else {
+      this->cancel_timeout("for");
+    }
+    this->state_callback_.call();
+  }
+
+  Condition<> *condition_;
+  uint32_t time_{0};
+  uint32_t last_inactive_{0};
+  bool active_{false};
+  CallbackManager<void()> state_callback_{};
+};
+
 class StartupTrigger : public Trigger<>, public Component {
  public:
   explicit StartupTrigger(float setup_priority) : setup_priority_(setup_priority) {}
@@ -155,16 +208,85 @@ template<typename... Ts> class DelayAction : public Action<Ts...>, public Compon
   TEMPLATABLE_VALUE(uint32_t, delay)
 
   void play_complex(Ts... x) override {
-    auto f = std::bind(&DelayAction<Ts...>::play_next_, this, x...);
     this->num_running_++;
-    this->set_timeout(this->delay_.value(x...), f);
+    // The arguments of every run are kept here instead of being bound into the timeout callback. Together with the
+    // scheduler reusing its items, a delay doesn't allocate once the storage has grown to the number of parallel runs.
+    this->pending_.push_back(PendingRun{millis(), this->delay_.value(x...), std::make_tuple(x...)});
+    this->schedule_next_();
   }
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
 
   void play(Ts... x) override { /* ignore - see play_complex */
   }
 
-  void stop() override { this->cancel_timeout(""); }
+  void stop() override {
+    this->cancel_timeout("delay");
+    this->pending_.clear();
+    this->timeout_set_ = false;
+  }
+
+ protected:
+  struct PendingRun {
+    uint32_t start;
+    uint32_t delay;
+    std::tuple<Ts...> args;
+
+    uint32_t remaining(uint32_t now) const { return remaining_(this->start, this->delay, now); }
+  };
+
+  static uint32_t remaining_(uint32_t start, uint32_t delay, uint32_t now) {
+    const uint32_t elapsed = now - start;
+    return elapsed >= delay ? 0 : delay - elapsed;
+  }
+
+  /// Index of the run among the first `count` that finishes first.
+  size_t next_run_(uint32_t now, size_t count) const {
+    size_t next = 0;
+    for (size_t i = 1; i < count; i++) {
+      if (this->pending_[i].remaining(now) < this->pending_[next].remaining(now))
+        next = i;
+    }
+    return next;
+  }
+
+  /// A single timeout is used for the run that finishes first.
+  void schedule_next_() {
+    if (this->pending_.empty())
+      return;
+    const uint32_t now = millis();
+    const PendingRun &next = this->pending_[this->next_run_(now, this->pending_.size())];
+    const uint32_t remaining = next.remaining(now);
+    // Keep the timeout that is already set if it isn't later
+    if (this->timeout_set_ && remaining_(this->timeout_start_, this->timeout_delay_, now) <= remaining)
+      return;
+    this->timeout_set_ = true;
+    this->timeout_start_ = now;
+    this->timeout_delay_ = remaining;
+    this->set_timeout("delay", remaining, [this]() { this->play_finished_(); });
+  }
+
+  void play_finished_() {
+    this->timeout_set_ = false;
+    const uint32_t now = millis();
+    // Runs added while playing the next actions are left for the next timeout, like a new timeout would be
+    size_t count = this->pending_.size();
+    while (count > 0) {
+      const size_t next = this->next_run_(now, count);
+      if (this->pending_[next].remaining(now) > 0)
+        break;
+      auto args = std::move(this->pending_[next].args);
+      this->pending_.erase(this->pending_.begin() + next);
+      this->play_next_tuple_(args);
+      // stop() may have cleared the runs in the meantime
+      count = std::min(count - 1, this->pending_.size());
+    }
+    this->schedule_next_();
+  }
+
+  std::vector<PendingRun> pending_;
+  uint32_t timeout_start_{0};
+  uint32_t timeout_delay_{0};
+  bool timeout_set_{false};
 };
 
 template<typename... Ts> class LambdaAction : public Action<Ts...> {
@@ -306,12 +428,22 @@ template<typename... Ts> class RepeatAction : public Action<Ts...> {
   std::tuple<Ts...> var_;
 };
 
-template<typename... Ts> class WaitUntilAction : public Action<Ts...>, public Component {
+/// A wait_until whose condition only reads entity states. Instead of polling from loop(), the condition is re-checked
+/// on the next loop after the state of one of those entities changed.
+template<typename... Ts> class ReactiveWaitUntilAction : public Action<Ts...>, public Component {
  public:
-  WaitUntilAction(Condition<Ts...> *condition) : condition_(condition) {}
+  ReactiveWaitUntilAction(Condition<Ts...> *condition) : condition_(condition) {}
 
   TEMPLATABLE_VALUE(uint32_t, timeout_value)
 
+  /// Re-check the condition whenever the state of `entity` changes.
+  template<typename T> void watch(T *entity) {
+    entity->add_on_state_callback([this](auto &&...) {
+      if (this->num_running_ > 0)
+        this->defer("check", [this]() { this->check_(); });
+    });
+  }
+
   void play_complex(Ts... x) override {
     this->num_running_++;
     // Check if we can continue immediately.
@@ -324,24 +456,11 @@ template<typename... Ts> class WaitUntilAction : public Action<Ts...>, public Co
     this->var_ = std::make_tuple(x...);
 
     if (this->timeout_value_.has_value()) {
-      auto f = std::bind(&WaitUntilAction<Ts...>::play_next_, this, x...);
-      this->set_timeout("timeout", this->timeout_value_.value(x...), f);
+      this->set_timeout("timeout", this->timeout_value_.value(x...),
+                        [this]() { this->play_next_tuple_(this->var_); });
     }
 
-    this->loop();
-  }
-
-  void loop() override {
-    if (this->num_running_ == 0)
-      return;
-
-    if (!this->condition_->check_tuple(this->var_)) {
-      return;
-    }
-
-    this->cancel_timeout("timeout");
-
-    this->play_next_tuple_(this->var_);
+    this->check_();
   }
 
   float get_setup_priority() const override { return setup_priority::DATA; }
@@ -352,10 +471,31 @@ template<typename... Ts> class WaitUntilAction : public Action<Ts...>, public Co
   void stop() override { this->cancel_timeout("timeout"); }
 
  protected:
+  void check_() {
+    // Every waiting run continues once the condition holds, not only the first one
+    while (this->num_running_ > 0) {
+      if (!this->condition_->check_tuple(this->var_)) {
+        return;
+      }
+
+      this->cancel_timeout("timeout");
+
+      this->play_next_tuple_(this->var_);
+    }
+  }
+
   Condition<Ts...> *condition_;
   std::tuple<Ts...> var_{};
 };
 
+/// A wait_until that polls its condition every loop, for conditions that can't be re-checked on state changes.
+template<typename... Ts> class WaitUntilAction : public ReactiveWaitUntilAction<Ts...> {
+ public:
+  using ReactiveWaitUntilAction<Ts...>::ReactiveWaitUntilAction;
+
+  void loop() override { this->check_(); }
+};
+
 template<typename... Ts> class UpdateComponentAction : public Action<Ts...> {
  public:
   UpdateComponentAction(PollingComponent *component) : component_(component) {}
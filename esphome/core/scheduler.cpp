@@ -10,6 +10,8 @@ namespace esphome {
 static const char *const TAG = "scheduler";
 
 static const uint32_t MAX_LOGICALLY_DELETED_ITEMS = 10;
+// Finished items that are kept for reuse, so that short timeouts (e.g. delays in automations) don't allocate each time
+static const size_t MAX_RECYCLED_ITEMS = 8;
 
 // Uncomment to debug scheduler
 // #define ESPHOME_DEBUG_SCHEDULER
@@ -31,7 +33,7 @@ void HOT Scheduler::set_timeout(Component *component, const std::string &name, u
 
   ESP_LOGVV(TAG, "set_timeout(name='%s', timeout=%" PRIu32 ")", name.c_str(), timeout);
 
-  auto item = make_unique<SchedulerItem>();
+  auto item = this->get_item_();
   item->component = component;
   item->name = name;
   item->type = SchedulerItem::TIMEOUT;
@@ -62,7 +64,7 @@ void HOT Scheduler::set_interval(Component *component, const std::string &name,
 
   ESP_LOGVV(TAG, "set_interval(name='%s', interval=%" PRIu32 ", offset=%" PRIu32 ")", name.c_str(), interval, offset);
 
-  auto item = make_unique<SchedulerItem>();
+  auto item = this->get_item_();
   item->component = component;
   item->name = name;
   item->type = SchedulerItem::INTERVAL;
@@ -157,8 +159,7 @@ void HOT Scheduler::call() {
     ESP_LOGVV(TAG, "Items: count=%u, now=%" PRIu32, this->items_.size(), now);
     while (!this->empty_()) {
       this->lock_.lock();
-      auto item = std::move(this->items_[0]);
-      this->pop_raw_();
+      auto item = this->pop_raw_();
       this->lock_.unlock();
 
       ESP_LOGVV(TAG, "  %s '%s' interval=%" PRIu32 " last_execution=%" PRIu32 " (%u) next=%" PRIu32 " (%u)",
@@ -183,9 +184,7 @@ void HOT Scheduler::call() {
     std::vector<std::unique_ptr<SchedulerItem>> valid_items;
     while (!this->empty_()) {
       LockGuard guard{this->lock_};
-      auto item = std::move(this->items_[0]);
-      this->pop_raw_();
-      valid_items.push_back(std::move(item));
+      valid_items.push_back(this->pop_raw_());
     }
 
     {
@@ -216,8 +215,10 @@ void HOT Scheduler::call() {
 
       // Don't run on failed components
       if (item->component != nullptr && item->component->is_failed()) {
-        LockGuard guard{this->lock_};
-        this->pop_raw_();
+        this->lock_.lock();
+        auto failed_item = this->pop_raw_();
+        this->lock_.unlock();
+        this->recycle_item_(std::move(failed_item));
         continue;
       }
 
@@ -239,17 +240,16 @@ void HOT Scheduler::call() {
       this->lock_.lock();
 
       // new scope, item from before might have been moved in the vector
-      auto item = std::move(this->items_[0]);
-
       // Only pop after function call, this ensures we were reachable
       // during the function call and know if we were cancelled.
-      this->pop_raw_();
+      auto item = this->pop_raw_();
 
       this->lock_.unlock();
 
       if (item->remove) {
         // We were removed/cancelled in the function call, stop
         to_remove_--;
+        this->recycle_item_(std::move(item));
         continue;
       }
 
@@ -262,6 +262,8 @@ void HOT Scheduler::call() {
             item->last_execution_major++;
         }
         this->push_(std::move(item));
+      } else {
+        this->recycle_item_(std::move(item));
       }
     }
   }
@@ -288,15 +290,35 @@ void HOT Scheduler::cleanup_() {
 
     to_remove_--;
 
-    {
-      LockGuard guard{this->lock_};
-      this->pop_raw_();
-    }
+    this->lock_.lock();
+    auto removed_item = this->pop_raw_();
+    this->lock_.unlock();
+    this->recycle_item_(std::move(removed_item));
   }
 }
-void HOT Scheduler::pop_raw_() {
+std::unique_ptr<Scheduler::SchedulerItem> HOT Scheduler::pop_raw_() {
   std::pop_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
+  auto item = std::move(this->items_.back());
   this->items_.pop_back();
+  return item;
+}
+std::unique_ptr<Scheduler::SchedulerItem> HOT Scheduler::get_item_() {
+  {
+    LockGuard guard{this->lock_};
+    if (!this->recycled_items_.empty()) {
+      auto item = std::move(this->recycled_items_.back());
+      this->recycled_items_.pop_back();
+      return item;
+    }
+  }
+  return make_unique<SchedulerItem>();
+}
+void HOT Scheduler::recycle_item_(std::unique_ptr<SchedulerItem> item) {
+  // Release what the callback captured now, and outside the lock, instead of when the item is reused
+  item->callback = nullptr;
+  LockGuard guard{this->lock_};
+  if (this->recycled_items_.size() < MAX_RECYCLED_ITEMS)
+    this->recycled_items_.push_back(std::move(item));
 }
 void HOT Scheduler::push_(std::unique_ptr<Scheduler::SchedulerItem> item) {
   LockGuard guard{this->lock_};
@@ -65,8 +65,11 @@ class Scheduler {
 
   uint32_t millis_();
   void cleanup_();
-  void pop_raw_();
+  std::unique_ptr<SchedulerItem> pop_raw_();
   void push_(std::unique_ptr<SchedulerItem> item);
+  // Take a finished item for reuse, or allocate a new one
+  std::unique_ptr<SchedulerItem> get_item_();
+  void recycle_item_(std::unique_ptr<SchedulerItem> item);
   bool cancel_item_(Component *component, const std::string &name, SchedulerItem::Type type);
   bool empty_() {
     this->cleanup_();
@@ -76,6 +79,7 @@ class Scheduler {
   Mutex lock_;
   std::vector<std::unique_ptr<SchedulerItem>> items_;
   std::vector<std::unique_ptr<SchedulerItem>> to_add_;
+  std::vector<std::unique_ptr<SchedulerItem>> recycled_items_;
   uint32_t last_millis_{0};
   uint8_t millis_major_{0};
   uint32_t to_remove_{0};